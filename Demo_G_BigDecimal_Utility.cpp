@@ -12,9 +12,12 @@ template <typename T>
 void print_arena_status(ArenaAlloc<T>& arena_alloc) {
 	size_t arena_fill = arena_alloc.meta->arena.Used;
 	size_t arena_capacity = arena_alloc.meta->arena.Size;
-	f32 arena_fill_percent = (f32)arena_fill/arena_capacity;
+	size_t overflow_fill = arena_alloc.meta->bytes_used() - arena_fill; //NOTE(##2026 10 18): bytes_used() counts the overflow blocks too
+	f32 arena_fill_percent = 100.f * arena_fill / arena_capacity;
 
-	cout << "Arena storage: " << arena_fill_percent << "% (" << arena_fill << " / " << arena_capacity << " Bytes)\n\n";
+	cout << "Arena storage: " << arena_fill_percent << "% (" << arena_fill << " / " << arena_capacity << " Bytes)";
+	cout << ", overflow: " << overflow_fill << " Bytes";
+	cout << ", high water: " << arena_alloc.meta->high_water << " Bytes\n\n";
 	return;
 }
 
@@ -43,7 +46,7 @@ i32 main() {
 	cout << "Demo: BigDecimal\n\n";
 
 
-	size_t arena_size = Kilobytes(8);
+	size_t arena_size = Kilobytes(2); //NOTE(##2026 10 18): the last inputs don't fit, the arena continues in overflow blocks
 	u8 *arena_storage = new u8[arena_size]{};
 	ChunkArena arena_alloc = ChunkArena{arena_size, arena_storage, deleter_std};
 	BigDecimal<ChunkArena>::initialize_context(arena_alloc);
@@ -10,6 +10,15 @@
 #include <limits> //NOTE(ArokhSlade##2024 09 21): used for MAX_CHUNK_VAL
 #include <type_traits> //enable_if, is_integral
 #include <concepts> //unsigned_integral
+#include <atomic>
+#include <memory>
+#include <utility> //swap
+#include <algorithm> //swap_ranges
+#include <array>
+#include <cmath> //frexp, ldexp
+#include <cstring> //memmove
+#include <bit> //countl_zero
+#include <compare> //strong_ordering
 
 namespace BigDecimal_ {
 	typedef u64 ChunkBits;
@@ -25,6 +34,1876 @@ struct BigDecimal;
 template <typename T_ChunkBitsAlloc, typename T_CharAlloc>
 auto to_chars(BigDecimal<T_ChunkBitsAlloc>& A, T_CharAlloc& char_alloc) -> char *;
 
+template <typename uN>
+void FullMulN(uN A, uN B, uN C[2]);
+
+
+/* Limb primitives
+ * full chunk * chunk product and chunk add/sub with carry, picked at compile time:
+ *     product:  unsigned __int128 where the compiler has it (g++ and clang on 64 bit targets), _umul128 on MSVC x64, FullMulN otherwise.
+ *     add/sub:  _addcarry_u64 / _subborrow_u64 on x86-64, plain compares otherwise.
+ * define BIG_DECIMAL_PORTABLE_LIMBS to get the portable versions everywhere, e.g. to test them.
+ */
+#if !defined(BIG_DECIMAL_PORTABLE_LIMBS) && (defined(__x86_64__) || defined(_M_X64))
+    #define BIG_DECIMAL_X64_LIMBS 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+#if !defined(BIG_DECIMAL_PORTABLE_LIMBS) && defined(__SIZEOF_INT128__)
+    #define BIG_DECIMAL_INT128_LIMBS 1
+#endif
+
+namespace BigDecimal_ {
+
+    static_assert(sizeof(ChunkBits) == 8, "the limb primitives assume 64 bit chunks");
+
+    //NOTE(##2026 10 18): lzcnt / tzcnt (bsr / bsf) through <bit>, the BitScan templates of G_Miscellany_Utility test bit by bit
+    /** \return number of leading zero bits, X must not be 0 */
+    inline auto leading_zeros(ChunkBits X) -> u32 {
+        return static_cast<u32>(std::countl_zero(X));
+    }
+
+    /** \return number of trailing zero bits, X must not be 0 */
+    inline auto trailing_zeros(ChunkBits X) -> u32 {
+        return static_cast<u32>(std::countr_zero(X));
+    }
+
+    /** \brief  Prod[1]:Prod[0] = A * B, same layout as FullMulN */
+    inline auto full_mul_chunk(ChunkBits A, ChunkBits B, ChunkBits Prod[2]) -> void {
+#if defined(BIG_DECIMAL_INT128_LIMBS)
+        __extension__ unsigned __int128 Full = static_cast<unsigned __int128>(A) * B;
+        Prod[0] = static_cast<ChunkBits>(Full);
+        Prod[1] = static_cast<ChunkBits>(Full >> 64);
+#elif defined(BIG_DECIMAL_X64_LIMBS) && defined(_MSC_VER)
+        unsigned long long High;
+        Prod[0] = _umul128(A, B, &High);
+        Prod[1] = High;
+#else
+        FullMulN<ChunkBits>(A, B, Prod);
+#endif
+    }
+
+    /** \brief  *Sum = A + B + Carry, Carry is 0 or 1
+     *  \return carry out (0 or 1)
+     */
+    inline auto add_carry(ChunkBits Carry, ChunkBits A, ChunkBits B, ChunkBits *Sum) -> ChunkBits {
+#if defined(BIG_DECIMAL_X64_LIMBS)
+        unsigned long long Out;
+        ChunkBits CarryOut = _addcarry_u64(static_cast<unsigned char>(Carry), A, B, &Out);
+        *Sum = Out;
+        return CarryOut;
+#else
+        ChunkBits Out = A + Carry;
+        Carry = Out < Carry;
+        Out += B;
+        Carry += Out < B;
+        *Sum = Out;
+        return Carry;
+#endif
+    }
+
+    /** \brief  *Difference = A - B - Borrow, Borrow is 0 or 1
+     *  \return borrow out (0 or 1)
+     */
+    inline auto sub_borrow(ChunkBits Borrow, ChunkBits A, ChunkBits B, ChunkBits *Difference) -> ChunkBits {
+#if defined(BIG_DECIMAL_X64_LIMBS)
+        unsigned long long Out;
+        ChunkBits BorrowOut = _subborrow_u64(static_cast<unsigned char>(Borrow), A, B, &Out);
+        *Difference = Out;
+        return BorrowOut;
+#else
+        ChunkBits Subtrahend = B + Borrow;
+        Borrow = Subtrahend < Borrow; //NOTE(##2026 10 18): B == MAX && Borrow -> subtract 2^width, i.e. leave A alone and keep borrowing
+        Borrow += A < Subtrahend;
+        *Difference = A - Subtrahend;
+        return Borrow;
+#endif
+    }
+}
+
+
+/* Chunk array kernels
+ * operate on plain contiguous chunk arrays (least significant chunk first).
+ * they know nothing about sign, exponent or allocation: callers make sure the destination is big enough.
+ */
+namespace BigDecimal_ {
+
+    /** \brief  Dst[0..Count) = A[0..Count) + B[0..Count) + Carry
+     *  \return carry out of the top chunk (0 or 1)
+     *  \note   Dst may alias A or B
+     */
+    inline auto add_chunks(ChunkBits *Dst, ChunkBits const *A, ChunkBits const *B, i32 Count, ChunkBits Carry = 0) -> ChunkBits {
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            Carry = add_carry(Carry, A[Idx], B[Idx], Dst + Idx);
+        }
+        return Carry;
+    }
+
+    /** \brief  Dst[0..Count) = A[0..Count) + Value, i.e. propagates a single chunk through A
+     *  \return carry out of the top chunk (0 or 1)
+     */
+    inline auto add_chunk(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits Value) -> ChunkBits {
+        i32 Idx = 0;
+        for ( ; Idx < Count && Value ; ++Idx) {
+            ChunkBits Sum = A[Idx] + Value;
+            Value = Sum < Value;
+            Dst[Idx] = Sum;
+        }
+        if (Dst != A) {
+            for ( ; Idx < Count ; ++Idx) Dst[Idx] = A[Idx];
+        }
+        return Value;
+    }
+
+    /** \brief  Dst[0..Count) = A[0..Count) - B[0..Count) - Borrow
+     *  \return borrow out of the top chunk (0 or 1)
+     *  \note   Dst may alias A or B
+     */
+    inline auto sub_chunks(ChunkBits *Dst, ChunkBits const *A, ChunkBits const *B, i32 Count, ChunkBits Borrow = 0) -> ChunkBits {
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            Borrow = sub_borrow(Borrow, A[Idx], B[Idx], Dst + Idx);
+        }
+        return Borrow;
+    }
+
+    /** \brief  Dst[0..Count) = A[0..Count) - Value, i.e. propagates a single chunk borrow through A
+     *  \return borrow out of the top chunk (0 or 1)
+     */
+    inline auto sub_chunk(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits Value) -> ChunkBits {
+        i32 Idx = 0;
+        for ( ; Idx < Count && Value ; ++Idx) {
+            ChunkBits Difference = A[Idx] - Value;
+            Value = A[Idx] < Value;
+            Dst[Idx] = Difference;
+        }
+        if (Dst != A) {
+            for ( ; Idx < Count ; ++Idx) Dst[Idx] = A[Idx];
+        }
+        return Value;
+    }
+
+    /** \brief  Dst[0..Count) = A[0..Count) * B
+     *  \return the chunk that overflows the top, i.e. the product has Count+1 chunks
+     */
+    inline auto mul_chunk_generic(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        ChunkBits Carry = 0;
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            ChunkBits Prod[2];
+            full_mul_chunk(A[Idx], B, Prod);
+            Carry = Prod[1] + add_carry(0, Prod[0], Carry, Dst + Idx);
+        }
+        return Carry;
+    }
+
+    /** \brief  Dst[0..Count) += A[0..Count) * B
+     *  \return the chunk that overflows the top
+     */
+    inline auto addmul_chunk_generic(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        ChunkBits Carry = 0;
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            ChunkBits Prod[2];
+            full_mul_chunk(A[Idx], B, Prod);
+            Carry = Prod[1] + add_carry(0, Prod[0], Carry, Prod);
+            Carry += add_carry(0, Dst[Idx], Prod[0], Dst + Idx); //NOTE(##2026 10 18): Prod[1] < MAX, so Carry cannot overflow
+        }
+        return Carry;
+    }
+
+    /** \brief  Dst[0..Count) -= A[0..Count) * B
+     *  \return the chunk that is still to be subtracted above the top
+     */
+    inline auto submul_chunk_generic(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        ChunkBits Carry = 0;
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            ChunkBits Prod[2];
+            full_mul_chunk(A[Idx], B, Prod);
+            Carry = Prod[1] + add_carry(0, Prod[0], Carry, Prod);
+            Carry += sub_borrow(0, Dst[Idx], Prod[0], Dst + Idx);
+        }
+        return Carry;
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Count) << Offset, 0 <= Offset < CHUNK_WIDTH
+     *  \return the bits shifted out of the top chunk
+     *  \note   works top-down, so Dst may overlap Src as long as Dst >= Src
+     */
+    inline auto shift_left_chunks_generic(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count <= 0) return 0;
+        if (Offset == 0) { //NOTE(##2026 10 18): whole chunk shift
+            std::memmove(Dst, Src, sizeof(ChunkBits) * Count);
+            return 0;
+        }
+        constexpr u32 Width = sizeof(ChunkBits) * 8;
+        ChunkBits Out = Src[Count-1] >> (Width - Offset);
+        for (i32 Idx = Count-1 ; Idx > 0 ; --Idx) {
+            Dst[Idx] = (Src[Idx] << Offset) | (Src[Idx-1] >> (Width - Offset));
+        }
+        Dst[0] = Src[0] << Offset;
+        return Out;
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Count) >> Offset, 0 <= Offset < CHUNK_WIDTH
+     *  \return the bits shifted out of the bottom chunk, aligned to the top of the returned chunk
+     *  \note   works bottom-up, so Dst may overlap Src as long as Dst <= Src
+     */
+    inline auto shift_right_chunks_generic(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count <= 0) return 0;
+        if (Offset == 0) { //NOTE(##2026 10 18): whole chunk shift
+            std::memmove(Dst, Src, sizeof(ChunkBits) * Count);
+            return 0;
+        }
+        constexpr u32 Width = sizeof(ChunkBits) * 8;
+        ChunkBits Out = Src[0] << (Width - Offset);
+        for (i32 Idx = 0 ; Idx < Count-1 ; ++Idx) {
+            Dst[Idx] = (Src[Idx] >> Offset) | (Src[Idx+1] << (Width - Offset));
+        }
+        Dst[Count-1] = Src[Count-1] >> Offset;
+        return Out;
+    }
+
+    /** \return true if A[0..An) and B[0..Bn) hold the same bits once the trailing zero bits of both are dropped, e.g. 0b1011000 and 0b1011
+     *  \note   An and Bn must not count leading zero chunks
+     */
+    inline auto equal_chunks_but_trailing_zeros(ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn) -> bool {
+        while (An > 1 && A[0] == 0x0) { ++A; --An; }
+        while (Bn > 1 && B[0] == 0x0) { ++B; --Bn; }
+        if (A[0] == 0x0 || B[0] == 0x0) return A[0] == B[0];
+        u32 OffsetA = trailing_zeros(A[0]);
+        u32 OffsetB = trailing_zeros(B[0]);
+        //NOTE(##2026 10 18): the chunks of A >> OffsetA, the top one may shift out entirely
+        auto shifted = [](ChunkBits const *X, i32 Xn, u32 Offset, i32 Idx) -> ChunkBits {
+            ChunkBits High = Offset != 0 && Idx+1 < Xn ? X[Idx+1] << (CHUNK_WIDTH - Offset) : 0x0;
+            return (X[Idx] >> Offset) | High;
+        };
+        i32 CountA = An - ((A[An-1] >> OffsetA) == 0x0);
+        i32 CountB = Bn - ((B[Bn-1] >> OffsetB) == 0x0);
+        if (CountA != CountB) return false;
+        for (i32 Idx = 0 ; Idx < CountA ; ++Idx) {
+            if (shifted(A, An, OffsetA, Idx) != shifted(B, Bn, OffsetB, Idx)) return false;
+        }
+        return true;
+    }
+
+    /** \return -1, 0, 1 if A[0..Count) is less than, equal to, greater than B[0..Count) */
+    inline auto compare_chunks(ChunkBits const *A, ChunkBits const *B, i32 Count) -> i32 {
+        for (i32 Idx = Count-1 ; Idx >= 0 ; --Idx) {
+            if (A[Idx] != B[Idx]) return A[Idx] < B[Idx] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    /** \return -1, 0, 1 if A[0..An) is less than, equal to, greater than B[0..Bn) with both aligned at their leading 1,
+     *          i.e. the mantissas 1.xyz of two fractionals. the shorter one reads as zeros below its last chunk.
+     *  \note   An and Bn must not count leading zero chunks. stops at the first chunk that differs.
+     */
+    inline auto compare_chunks_from_top(ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn) -> i32 {
+        u32 ShiftA = static_cast<u32>(std::countl_zero(A[An-1]));
+        u32 ShiftB = static_cast<u32>(std::countl_zero(B[Bn-1]));
+        //NOTE(##2026 10 18): the K-th chunk from the top, shifted up to the leading 1 in a register, nothing is copied
+        auto from_top = [](ChunkBits const *X, i32 Xn, u32 Shift, i32 K) -> ChunkBits {
+            i32 Idx = Xn-1 - K;
+            ChunkBits High = Idx >= 0 ? X[Idx] << Shift : 0x0;
+            ChunkBits Low = Shift != 0 && Idx >= 1 ? X[Idx-1] >> (CHUNK_WIDTH - Shift) : 0x0;
+            return High | Low;
+        };
+        i32 Count = An > Bn ? An : Bn;
+        for (i32 K = 0 ; K < Count ; ++K) {
+            ChunkBits ChunkA = from_top(A, An, ShiftA, K);
+            ChunkBits ChunkB = from_top(B, Bn, ShiftB, K);
+            if (ChunkA != ChunkB) return ChunkA < ChunkB ? -1 : 1;
+        }
+        return 0;
+    }
+
+    /** \return whether any of the bits [0..BitCount) of A[0..Count) is set */
+    inline auto any_bits_below(ChunkBits const *A, i32 Count, i32 BitCount) -> bool {
+        i32 Whole = BitCount / CHUNK_WIDTH;
+        for (i32 Idx = 0 ; Idx < Whole && Idx < Count ; ++Idx) {
+            if (A[Idx] != 0x0) return true;
+        }
+        u32 Rest = BitCount % CHUNK_WIDTH;
+        return Whole < Count && Rest != 0 && (A[Whole] & GetMaskBottomN<ChunkBits>(Rest)) != 0x0;
+    }
+
+    /** \brief  the IEEE binary float with Precision significant bits and ExponentBits exponent bits (24/8 for f32, 53/11 for f64)
+     *          nearest to (-1)^Negative * A[0..Count) * 2^(Exponent - msb of A): round-to-even, subnormals, overflow to infinity.
+     *  \return sign|exponent|mantissa in the low Precision + ExponentBits bits
+     *  \note   A[Count-1] must not be 0. reads the top two chunks, the ones below only until a sticky bit is found.
+     */
+    inline auto round_to_float_bits(ChunkBits const *A, i32 Count, i32 Exponent, bool Negative, i32 Precision, i32 ExponentBits) -> u64 {
+        HardAssert(A[Count-1] != 0x0 && Precision <= CHUNK_WIDTH);
+        i32 Bias = (1 << (ExponentBits - 1)) - 1;
+        i32 MinNormal = 1 - Bias;
+        u64 SignBit = static_cast<u64>(Negative) << (Precision - 1 + ExponentBits);
+        u64 InfBits = static_cast<u64>(2 * Bias + 1) << (Precision - 1);
+        if (Exponent > Bias) return SignBit | InfBits;
+
+        //NOTE(##2026 10 18): the top 64 significant bits, msb at bit 63, and whether any 1 bit comes after them
+        i32 Zeros = std::countl_zero(A[Count-1]);
+        ChunkBits Top = A[Count-1] << Zeros;
+        bool Sticky = false;
+        if (Count > 1) {
+            if (Zeros != 0) Top |= A[Count-2] >> (CHUNK_WIDTH - Zeros);
+            Sticky = (A[Count-2] << Zeros) != 0x0;
+            for (i32 Idx = Count-3 ; Idx >= 0 && !Sticky ; --Idx) Sticky = A[Idx] != 0x0;
+        }
+
+        i32 Keep = Exponent >= MinNormal ? Precision : Precision - (MinNormal - Exponent); //NOTE(##2026 10 18): subnormals keep fewer bits
+        if (Keep < 0) return SignBit;
+        i32 Drop = CHUNK_WIDTH - Keep;
+        u64 Mantissa = Keep == 0 ? 0 : Top >> Drop;
+        bool Guard = (Top >> (Drop - 1)) & 0x1;
+        Sticky = Sticky || (Drop > 1 && (Top << (CHUNK_WIDTH - Drop + 1)) != 0x0);
+        Mantissa += Guard && (Sticky || (Mantissa & 0x1));
+
+        //NOTE(##2026 10 18): the mantissa's leading bit lands on the exponent field, a carry out of the mantissa moves on to
+        //                    the next exponent, the largest one carries into infinity, the largest subnormal into the smallest normal
+        u64 ExponentField = Exponent >= MinNormal ? static_cast<u64>(Exponent + Bias - 1) << (Precision - 1) : 0;
+        return SignBit | (ExponentField + Mantissa);
+    }
+
+    /** \brief  decodes an IEEE binary float (Precision and ExponentBits as for round_to_float_bits): the inverse of round_to_float_bits.
+     *  \return the significand without trailing zero bits, 0 for zero
+     *  \note   *Exponent gets the exponent of the leading 1, -Bias for zero. Inf and NaN decode like normal numbers.
+     */
+    inline auto float_bits_to_chunk(u64 Bits, i32 Precision, i32 ExponentBits, i32 *Exponent) -> ChunkBits {
+        i32 Bias = (1 << (ExponentBits - 1)) - 1;
+        i32 MantissaBits = Precision - 1;
+        ChunkBits Mantissa = Bits & GetMaskBottomN<u64>(MantissaBits);
+        i32 BiasedExponent = static_cast<i32>((Bits >> MantissaBits) & GetMaskBottomN<u64>(ExponentBits));
+        if (BiasedExponent != 0) {
+            Mantissa |= 1ull << MantissaBits;
+            *Exponent = BiasedExponent - Bias;
+        } else if (Mantissa != 0x0) { //NOTE(##2026 10 18): subnormal, Mantissa * 2^(1 - Bias - MantissaBits)
+            *Exponent = 1 - Bias - MantissaBits + (CHUNK_WIDTH - 1 - static_cast<i32>(leading_zeros(Mantissa)));
+        } else {
+            *Exponent = -Bias;
+            return 0x0;
+        }
+        return Mantissa >> trailing_zeros(Mantissa);
+    }
+
+    /** \return number of chunks without the leading zero chunks, at least 1 */
+    inline auto significant_chunks(ChunkBits const *A, i32 Count) -> i32 {
+        while (Count > 1 && A[Count-1] == 0x0) --Count;
+        return Count;
+    }
+
+    inline auto zero_chunks(ChunkBits *Dst, i32 Count) -> void {
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) Dst[Idx] = 0x0;
+    }
+
+    inline auto copy_chunks(ChunkBits *Dst, ChunkBits const *Src, i32 Count) -> void {
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) Dst[Idx] = Src[Idx];
+    }
+}
+
+
+/* Chunk kernel dispatch
+ * the kernels below pick a variant for the CPU they run on, once, on first use:
+ *     addmul_chunk (the schoolbook inner loop): MULX with two interleaved ADCX/ADOX carry chains on BMI2 + ADX hosts.
+ *     shift_left_chunks, shift_right_chunks: 8 chunks per step with the AVX-512 VBMI2 funnel shifts (VPSHLDVQ / VPSHRDVQ),
+ *     or 4 chunks per step with AVX2 where that's missing.
+ * mul_chunk and submul_chunk go through the table as well, so a variant can be plugged in, but have only one carry chain,
+ * where MULX measured no faster than the generic kernels. the same goes for add_chunks / sub_chunks, which aren't dispatched at all.
+ * short arrays (below CHUNK_KERNELS_MIN_COUNT, where a call through a pointer costs more than it saves) always use the
+ * generic kernels above, which stay inlineable and unrollable for compile-time counts.
+ */
+#if defined(BIG_DECIMAL_X64_LIMBS)
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define BIG_DECIMAL_TARGET(Features)
+    #else
+        #define BIG_DECIMAL_TARGET(Features) __attribute__((target(Features)))
+    #endif
+#endif
+
+namespace BigDecimal_ {
+
+    constexpr i32 CHUNK_KERNELS_MIN_COUNT = 16;
+
+    using MulChunkKernel   = auto (*)(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits;
+    using ShiftChunkKernel = auto (*)(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits;
+
+    /** \brief  the kernels in use, see chunk_kernels(). a default constructed table holds the generic kernels. */
+    struct ChunkKernels {
+        MulChunkKernel mul_chunk = mul_chunk_generic;
+        MulChunkKernel addmul_chunk = addmul_chunk_generic;
+        MulChunkKernel submul_chunk = submul_chunk_generic;
+        ShiftChunkKernel shift_left_chunks = shift_left_chunks_generic;
+        ShiftChunkKernel shift_right_chunks = shift_right_chunks_generic;
+    };
+
+#if defined(BIG_DECIMAL_X64_LIMBS)
+
+    struct CpuFeatures {
+        bool bmi2 = false;
+        bool adx = false;
+        bool avx2 = false;
+        bool avx512vbmi2 = false; //NOTE(##2026 10 18): implies AVX512F
+    };
+
+    inline auto cpu_features() -> CpuFeatures {
+        CpuFeatures Result;
+#if defined(_MSC_VER) && !defined(__clang__)
+        int Info[4] = {};
+        __cpuid(Info, 0);
+        if (Info[0] < 7) return Result;
+        __cpuid(Info, 1);
+        bool OsXsave = (Info[2] & (1 << 27)) && (Info[2] & (1 << 28)); //NOTE(##2026 10 18): OSXSAVE, AVX
+        unsigned long long SavedState = OsXsave ? _xgetbv(0) : 0;
+        bool YmmEnabled = (SavedState & 0x6) == 0x6;
+        bool ZmmEnabled = (SavedState & 0xE6) == 0xE6; //NOTE(##2026 10 18): the OS saves the ymm, opmask and zmm registers
+        __cpuidex(Info, 7, 0);
+        Result.bmi2 = Info[1] & (1 << 8);
+        Result.adx  = Info[1] & (1 << 19);
+        Result.avx2 = (Info[1] & (1 << 5)) && YmmEnabled;
+        Result.avx512vbmi2 = (Info[1] & (1 << 16)) && (Info[2] & (1 << 6)) && ZmmEnabled;
+#else
+        __builtin_cpu_init();
+        Result.bmi2 = __builtin_cpu_supports("bmi2");
+        Result.adx  = __builtin_cpu_supports("adx");
+        Result.avx2 = __builtin_cpu_supports("avx2");
+        Result.avx512vbmi2 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vbmi2");
+#endif
+        return Result;
+    }
+
+    /** \brief  addmul_chunk with MULX and two independent carry chains: ADCX adds Dst, ADOX adds the high half of the previous product.
+     *  \note   g++ and clang turn _addcarryx_u64 into one ADC chain, so they get the loop in assembly. it keeps CF and OF alive
+     *          across iterations, hence LEA for the pointers and JRCXZ for the loop test.
+     */
+    BIG_DECIMAL_TARGET("bmi2,adx")
+    inline auto addmul_chunk_adx(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        if (Count <= 0) return 0;
+#if defined(__GNUC__)
+        //NOTE(##2026 10 18): the loop takes 4 chunks per step, the ones left over go first
+        i32 Leftover = Count % 4;
+        unsigned long long High = addmul_chunk_generic(Dst, A, Leftover, B);
+        unsigned long long Steps = static_cast<unsigned long long>(Count / 4);
+        if (Steps == 0) return High;
+        A += Leftover;
+        Dst += Leftover;
+        asm volatile (
+            "movq %[high], %%r8\n\t"               // r8 holds the high half of the previous product
+            "xorl %%r9d, %%r9d\n\t"                // clears CF and OF
+            "1:\n\t"
+            "mulx (%[a]), %%r9, %%r10\n\t"         // r10:r9 = A[Idx] * B
+            "adcx (%[dst]), %%r9\n\t"
+            "adox %%r8, %%r9\n\t"
+            "movq %%r9, (%[dst])\n\t"
+            "mulx 8(%[a]), %%r9, %%r8\n\t"
+            "adcx 8(%[dst]), %%r9\n\t"
+            "adox %%r10, %%r9\n\t"
+            "movq %%r9, 8(%[dst])\n\t"
+            "mulx 16(%[a]), %%r9, %%r10\n\t"
+            "adcx 16(%[dst]), %%r9\n\t"
+            "adox %%r8, %%r9\n\t"
+            "movq %%r9, 16(%[dst])\n\t"
+            "mulx 24(%[a]), %%r9, %%r8\n\t"
+            "adcx 24(%[dst]), %%r9\n\t"
+            "adox %%r10, %%r9\n\t"
+            "movq %%r9, 24(%[dst])\n\t"
+            "leaq 32(%[a]), %[a]\n\t"
+            "leaq 32(%[dst]), %[dst]\n\t"
+            "leaq -1(%[n]), %[n]\n\t"
+            "jrcxz 2f\n\t"
+            "jmp 1b\n\t"
+            "2:\n\t"
+            "movl $0, %%r9d\n\t"
+            "adcx %%r9, %%r8\n\t"
+            "adox %%r9, %%r8\n\t"
+            "movq %%r8, %[high]\n\t"
+            : [a] "+r" (A), [dst] "+r" (Dst), [n] "+c" (Steps), [high] "+r" (High)
+            : "d" (B)
+            : "r8", "r9", "r10", "cc", "memory");
+        return High; //NOTE(##2026 10 18): the top chunk of A * B + Dst + carries fits, the high half is < MAX
+#else
+        unsigned char CarryLow = 0;
+        unsigned char CarryHigh = 0;
+        unsigned long long High = 0;
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            unsigned long long NextHigh;
+            unsigned long long Low = _mulx_u64(A[Idx], B, &NextHigh);
+            unsigned long long Sum;
+            CarryLow = _addcarryx_u64(CarryLow, Dst[Idx], Low, &Sum);
+            CarryHigh = _addcarryx_u64(CarryHigh, Sum, High, &Sum);
+            Dst[Idx] = Sum;
+            High = NextHigh;
+        }
+        return High + CarryLow + CarryHigh;
+#endif
+    }
+
+    /** \brief  shift_left_chunks, 4 chunks per step. loads come before the store of each step, so the overlap rules stay the same */
+    BIG_DECIMAL_TARGET("avx2")
+    inline auto shift_left_chunks_avx2(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count <= 0 || Offset == 0) return shift_left_chunks_generic(Dst, Src, Count, Offset);
+        ChunkBits Out = Src[Count-1] >> (CHUNK_WIDTH - Offset);
+        __m128i Left  = _mm_cvtsi32_si128(static_cast<int>(Offset));
+        __m128i Right = _mm_cvtsi32_si128(static_cast<int>(CHUNK_WIDTH - Offset));
+        i32 Idx = Count - 1;
+        for ( ; Idx >= 4 ; Idx -= 4) {
+            __m256i High = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + Idx - 3));
+            __m256i Low  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + Idx - 4));
+            __m256i Shifted = _mm256_or_si256(_mm256_sll_epi64(High, Left), _mm256_srl_epi64(Low, Right));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + Idx - 3), Shifted);
+        }
+        for ( ; Idx > 0 ; --Idx) {
+            Dst[Idx] = (Src[Idx] << Offset) | (Src[Idx-1] >> (CHUNK_WIDTH - Offset));
+        }
+        Dst[0] = Src[0] << Offset;
+        return Out;
+    }
+
+    /** \brief  shift_right_chunks, 4 chunks per step */
+    BIG_DECIMAL_TARGET("avx2")
+    inline auto shift_right_chunks_avx2(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count <= 0 || Offset == 0) return shift_right_chunks_generic(Dst, Src, Count, Offset);
+        ChunkBits Out = Src[0] << (CHUNK_WIDTH - Offset);
+        __m128i Right = _mm_cvtsi32_si128(static_cast<int>(Offset));
+        __m128i Left  = _mm_cvtsi32_si128(static_cast<int>(CHUNK_WIDTH - Offset));
+        i32 Idx = 0;
+        for ( ; Idx + 4 < Count ; Idx += 4) {
+            __m256i Low  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + Idx));
+            __m256i High = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + Idx + 1));
+            __m256i Shifted = _mm256_or_si256(_mm256_srl_epi64(Low, Right), _mm256_sll_epi64(High, Left));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + Idx), Shifted);
+        }
+        for ( ; Idx < Count-1 ; ++Idx) {
+            Dst[Idx] = (Src[Idx] >> Offset) | (Src[Idx+1] << (CHUNK_WIDTH - Offset));
+        }
+        Dst[Count-1] = Src[Count-1] >> Offset;
+        return Out;
+    }
+
+    /** \brief  shift_left_chunks, 8 chunks per step: VPSHLDVQ shifts each chunk left, filling in from the top of the chunk below */
+    BIG_DECIMAL_TARGET("avx512f,avx512vbmi2")
+    inline auto shift_left_chunks_avx512(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count <= 0 || Offset == 0) return shift_left_chunks_generic(Dst, Src, Count, Offset);
+        ChunkBits Out = Src[Count-1] >> (CHUNK_WIDTH - Offset);
+        __m512i Shift = _mm512_set1_epi64(static_cast<long long>(Offset));
+        i32 Idx = Count - 1;
+        for ( ; Idx >= 8 ; Idx -= 8) {
+            __m512i High = _mm512_loadu_si512(Src + Idx - 7);
+            __m512i Low  = _mm512_loadu_si512(Src + Idx - 8);
+            _mm512_storeu_si512(Dst + Idx - 7, _mm512_shldv_epi64(High, Low, Shift));
+        }
+        for ( ; Idx > 0 ; --Idx) {
+            Dst[Idx] = (Src[Idx] << Offset) | (Src[Idx-1] >> (CHUNK_WIDTH - Offset));
+        }
+        Dst[0] = Src[0] << Offset;
+        return Out;
+    }
+
+    /** \brief  shift_right_chunks, 8 chunks per step: VPSHRDVQ shifts each chunk right, filling in from the bottom of the chunk above */
+    BIG_DECIMAL_TARGET("avx512f,avx512vbmi2")
+    inline auto shift_right_chunks_avx512(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count <= 0 || Offset == 0) return shift_right_chunks_generic(Dst, Src, Count, Offset);
+        ChunkBits Out = Src[0] << (CHUNK_WIDTH - Offset);
+        __m512i Shift = _mm512_set1_epi64(static_cast<long long>(Offset));
+        i32 Idx = 0;
+        for ( ; Idx + 8 < Count ; Idx += 8) {
+            __m512i Low  = _mm512_loadu_si512(Src + Idx);
+            __m512i High = _mm512_loadu_si512(Src + Idx + 1);
+            _mm512_storeu_si512(Dst + Idx, _mm512_shrdv_epi64(Low, High, Shift));
+        }
+        for ( ; Idx < Count-1 ; ++Idx) {
+            Dst[Idx] = (Src[Idx] >> Offset) | (Src[Idx+1] << (CHUNK_WIDTH - Offset));
+        }
+        Dst[Count-1] = Src[Count-1] >> Offset;
+        return Out;
+    }
+
+#endif
+
+    /** \brief  the best kernels for the CPU this runs on */
+    inline auto detect_chunk_kernels() -> ChunkKernels {
+        ChunkKernels Result;
+#if defined(BIG_DECIMAL_X64_LIMBS)
+        CpuFeatures Features = cpu_features();
+        if (Features.bmi2 && Features.adx) {
+            Result.addmul_chunk = addmul_chunk_adx;
+        }
+        if (Features.avx512vbmi2) {
+            Result.shift_left_chunks = shift_left_chunks_avx512;
+            Result.shift_right_chunks = shift_right_chunks_avx512;
+        } else if (Features.avx2) {
+            Result.shift_left_chunks = shift_left_chunks_avx2;
+            Result.shift_right_chunks = shift_right_chunks_avx2;
+        }
+#endif
+        return Result;
+    }
+
+    /** \brief  the kernels in use, detected on first call.
+     *  \note   assign to it to pin a variant, e.g. chunk_kernels() = ChunkKernels{} for the generic kernels.
+     *          a function local static, so it's ready even for static initializers that compute with BigDecimal.
+     */
+    inline auto chunk_kernels() -> ChunkKernels& {
+        static ChunkKernels Kernels = detect_chunk_kernels();
+        return Kernels;
+    }
+
+    /** \brief  Dst[0..Count) = A[0..Count) * B
+     *  \return the chunk that overflows the top, i.e. the product has Count+1 chunks
+     */
+    inline auto mul_chunk(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        if (Count >= CHUNK_KERNELS_MIN_COUNT) return chunk_kernels().mul_chunk(Dst, A, Count, B);
+        return mul_chunk_generic(Dst, A, Count, B);
+    }
+
+    /** \brief  Dst[0..Count) += A[0..Count) * B
+     *  \return the chunk that overflows the top
+     */
+    inline auto addmul_chunk(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        if (Count >= CHUNK_KERNELS_MIN_COUNT) return chunk_kernels().addmul_chunk(Dst, A, Count, B);
+        return addmul_chunk_generic(Dst, A, Count, B);
+    }
+
+    /** \brief  Dst[0..Count) -= A[0..Count) * B
+     *  \return the chunk that is still to be subtracted above the top
+     */
+    inline auto submul_chunk(ChunkBits *Dst, ChunkBits const *A, i32 Count, ChunkBits B) -> ChunkBits {
+        if (Count >= CHUNK_KERNELS_MIN_COUNT) return chunk_kernels().submul_chunk(Dst, A, Count, B);
+        return submul_chunk_generic(Dst, A, Count, B);
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Count) << Offset, 0 <= Offset < CHUNK_WIDTH
+     *  \return the bits shifted out of the top chunk
+     *  \note   works top-down, so Dst may overlap Src as long as Dst >= Src
+     */
+    inline auto shift_left_chunks(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count >= CHUNK_KERNELS_MIN_COUNT) return chunk_kernels().shift_left_chunks(Dst, Src, Count, Offset);
+        return shift_left_chunks_generic(Dst, Src, Count, Offset);
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Count) >> Offset, 0 <= Offset < CHUNK_WIDTH
+     *  \return the bits shifted out of the bottom chunk, aligned to the top of the returned chunk
+     *  \note   works bottom-up, so Dst may overlap Src as long as Dst <= Src
+     */
+    inline auto shift_right_chunks(ChunkBits *Dst, ChunkBits const *Src, i32 Count, u32 Offset) -> ChunkBits {
+        if (Count >= CHUNK_KERNELS_MIN_COUNT) return chunk_kernels().shift_right_chunks(Dst, Src, Count, Offset);
+        return shift_right_chunks_generic(Dst, Src, Count, Offset);
+    }
+}
+
+
+/* Chunk array multiplication
+ * mul_chunks picks an algorithm by operand size: schoolbook, Karatsuba, Toom-3, Toom-4 or NTT.
+ * Karatsuba is treated as Toom-2, so all three share one evaluation/interpolation routine:
+ *     Toom-2 evaluates at {0, 1, inf}, Toom-3 at {0, 1, -1, 2, inf}, Toom-4 at {0, 1, -1, 2, -2, 3, inf}.
+ * intermediate values of the interpolation may be negative, they are kept in two's complement of fixed width.
+ * the NTT path does three number theoretic transforms (modulo three primes < 2^63) and combines them by CRT.
+ */
+namespace BigDecimal_ {
+
+    /** \brief  size of the shorter operand (in chunks) from which on mul_chunks uses the respective algorithm.
+     *  \note   the best values depend on the machine, tune them through BigDecimal_::mul_thresholds.
+     *          values below 4 are treated as 4.
+     */
+    struct MulThresholds {
+        i32 karatsuba = 24;
+        i32 toom3 = 96;
+        i32 toom4 = 192;
+        i32 ntt = 6144;
+    };
+
+    inline MulThresholds mul_thresholds {};
+
+    /** \brief  bump allocator over a caller-provided chunk buffer.
+     *  \note   meant to be passed by value: whatever a callee takes is given back when it returns.
+     */
+    struct ChunkScratch {
+        ChunkBits *Next;
+        ChunkBits *End;
+
+        auto take(i32 Count) -> ChunkBits* {
+            HardAssert(Count <= End - Next);
+            ChunkBits *Result = Next;
+            Next += Count;
+            return Result;
+        }
+    };
+
+    /** \brief  Dst[0..Count) = -Dst[0..Count), two's complement */
+    inline auto negate_chunks(ChunkBits *Dst, i32 Count) -> void {
+        ChunkBits Carry = 1;
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            Dst[Idx] = ~Dst[Idx] + Carry;
+            Carry = Carry && Dst[Idx] == 0x0;
+        }
+    }
+
+    /** \brief  Dst[0..Count) >>= Offset, arithmetic shift on two's complement, 0 < Offset < CHUNK_WIDTH */
+    inline auto shift_right_signed_chunks(ChunkBits *Dst, i32 Count, u32 Offset) -> void {
+        constexpr u32 Width = sizeof(ChunkBits) * 8;
+        bool IsNegative = Dst[Count-1] >> (Width-1);
+        shift_right_chunks(Dst, Dst, Count, Offset);
+        if (IsNegative) Dst[Count-1] |= MAX_CHUNK_VAL << (Width - Offset);
+    }
+
+    /** \brief  Dst[0..Count) /= Divisor, for odd Divisor and only if the division is known to be exact
+     *  \note   Hensel division, i.e. computes Dst * Divisor^-1 mod 2^(Count*CHUNK_WIDTH), so it works on two's complement too
+     */
+    inline auto divexact_chunks(ChunkBits *Dst, i32 Count, ChunkBits Divisor) -> void {
+        HardAssert(Divisor & 0x1);
+        ChunkBits Inverse = Divisor; //NOTE(##2026 10 18): correct to 3 bits, every Newton step doubles that
+        for (i32 Step = 0 ; Step < 5 ; ++Step) Inverse *= 2 - Divisor * Inverse;
+
+        ChunkBits Borrow = 0;
+        for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+            ChunkBits Cur = Dst[Idx];
+            ChunkBits Quotient = (Cur - Borrow) * Inverse;
+            Dst[Idx] = Quotient;
+            ChunkBits Prod[2] = {};
+            full_mul_chunk(Quotient, Divisor, Prod);
+            Borrow = Prod[1] + (Cur < Borrow);
+        }
+    }
+
+    /** \brief  Dst[Offset..DstCount) += Src[0..SrcCount), Src is cut off and the carry dropped at the top of Dst */
+    inline auto add_chunks_at(ChunkBits *Dst, i32 DstCount, i32 Offset, ChunkBits const *Src, i32 SrcCount) -> void {
+        if (Offset >= DstCount) return;
+        i32 Count = SrcCount < DstCount - Offset ? SrcCount : DstCount - Offset;
+        ChunkBits Carry = add_chunks(Dst + Offset, Dst + Offset, Src, Count);
+        add_chunk(Dst + Offset + Count, Dst + Offset + Count, DstCount - Offset - Count, Carry);
+    }
+
+    /** \brief  Dst[0..An+Bn) = A[0..An) * B[0..Bn), schoolbook
+     *  \note   Dst must not overlap A or B
+     */
+    inline auto mul_chunks_basecase(ChunkBits *Dst, ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn) -> void {
+        if (An == 0 || Bn == 0) {
+            zero_chunks(Dst, An + Bn);
+            return;
+        }
+        Dst[Bn] = mul_chunk(Dst, B, Bn, A[0]);
+        for (i32 IdxA = 1 ; IdxA < An ; ++IdxA) {
+            Dst[IdxA + Bn] = addmul_chunk(Dst + IdxA, B, Bn, A[IdxA]);
+        }
+    }
+
+    /** \brief  arithmetic modulo one of the NTT primes p < 2^63, values kept in Montgomery form a*2^64 mod p */
+    struct NttPrime {
+        ChunkBits P;
+        ChunkBits PNegInverse;  //-p^-1 mod 2^64
+        ChunkBits R2;           //2^128 mod p
+        ChunkBits One;          //1 in Montgomery form
+        ChunkBits Generator;    //primitive root mod p
+        i32 MaxLog2;            //p - 1 == c * 2^MaxLog2
+
+        NttPrime(ChunkBits P_, ChunkBits Generator_, i32 MaxLog2_) : P{P_}, Generator{Generator_}, MaxLog2{MaxLog2_} {
+            ChunkBits Inverse = P; //NOTE(##2026 10 18): correct to 3 bits, every Newton step doubles that
+            for (i32 Step = 0 ; Step < 5 ; ++Step) Inverse *= 2 - P * Inverse;
+            PNegInverse = 0 - Inverse;
+            One = (0 - P) % P;
+            R2 = One;
+            for (i32 Bit = 0 ; Bit < CHUNK_WIDTH ; ++Bit) {
+                R2 = add(R2, R2);
+            }
+        }
+
+        /** \brief  T * 2^-64 mod p for T = T[1]*2^64 + T[0] < p*2^64 */
+        auto reduce(ChunkBits const T[2]) const -> ChunkBits {
+            ChunkBits M = T[0] * PNegInverse;
+            ChunkBits MP[2] = {};
+            full_mul_chunk(M, P, MP);
+            ChunkBits Low = T[0] + MP[0];
+            ChunkBits Result = T[1] + MP[1] + (Low < T[0]);
+            return Result >= P ? Result - P : Result;
+        }
+
+        /** \note  A may be any 64-bit value as long as B < p */
+        auto mul(ChunkBits A, ChunkBits B) const -> ChunkBits {
+            ChunkBits T[2] = {};
+            full_mul_chunk(A, B, T);
+            return reduce(T);
+        }
+
+        auto add(ChunkBits A, ChunkBits B) const -> ChunkBits { ChunkBits S = A + B; return S >= P ? S - P : S; }
+        auto sub(ChunkBits A, ChunkBits B) const -> ChunkBits { return A >= B ? A - B : A + P - B; }
+
+        auto to_montgomery(ChunkBits A) const -> ChunkBits { return mul(A, R2); }
+        auto from_montgomery(ChunkBits A) const -> ChunkBits { ChunkBits T[2] = {A, 0}; return reduce(T); }
+
+        auto pow(ChunkBits Base, ChunkBits Exp) const -> ChunkBits {
+            ChunkBits Result = One;
+            for ( ; Exp ; Exp >>= 1, Base = mul(Base, Base)) {
+                if (Exp & 0x1) Result = mul(Result, Base);
+            }
+            return Result;
+        }
+        auto inverse(ChunkBits A) const -> ChunkBits { return pow(A, P - 2); }
+    };
+
+    /** \brief  the three primes of the NTT multiplication. their product is > 2^183, which is enough for convolutions
+     *          of up to 2^55 products of 64-bit chunks
+     */
+    inline NttPrime const& ntt_prime(i32 Idx) {
+        static NttPrime const Primes[3] = {
+            {0x3A00'0000'0000'0001ull, 3, 57},  //29 * 2^57 + 1
+            {0x2280'0000'0000'0001ull, 5, 55},  //69 * 2^55 + 1
+            {0x1B00'0000'0000'0001ull, 5, 56},  //27 * 2^56 + 1
+        };
+        return Primes[Idx];
+    }
+
+    /** \brief  Roots[j] = w^j for j < N/2, w a primitive N-th root of unity mod p, Montgomery form */
+    inline auto ntt_roots(ChunkBits *Roots, i32 N, NttPrime const& Prime) -> void {
+        ChunkBits W = Prime.pow(Prime.to_montgomery(Prime.Generator), (Prime.P - 1) / N);
+        Roots[0] = Prime.One;
+        for (i32 Idx = 1 ; Idx < N/2 ; ++Idx) Roots[Idx] = Prime.mul(Roots[Idx-1], W);
+    }
+
+    /** \brief  forward transform, decimation in frequency: natural order in, bit-reversed order out */
+    inline auto ntt_forward(ChunkBits *X, i32 N, ChunkBits const *Roots, NttPrime const& Prime) -> void {
+        for (i32 Len = N ; Len >= 2 ; Len >>= 1) {
+            i32 Half = Len / 2;
+            i32 Stride = N / Len;
+            for (i32 Block = 0 ; Block < N ; Block += Len) {
+                for (i32 Idx = 0 ; Idx < Half ; ++Idx) {
+                    ChunkBits U = X[Block + Idx];
+                    ChunkBits V = X[Block + Idx + Half];
+                    X[Block + Idx] = Prime.add(U, V);
+                    X[Block + Idx + Half] = Prime.mul(Prime.sub(U, V), Roots[Idx * Stride]);
+                }
+            }
+        }
+    }
+
+    /** \brief  inverse transform without the division by N, decimation in time: bit-reversed order in, natural order out
+     *  \note   w^-j == -w^(N/2-j)
+     */
+    inline auto ntt_inverse(ChunkBits *X, i32 N, ChunkBits const *Roots, NttPrime const& Prime) -> void {
+        for (i32 Len = 2 ; Len <= N ; Len <<= 1) {
+            i32 Half = Len / 2;
+            i32 Stride = N / Len;
+            for (i32 Block = 0 ; Block < N ; Block += Len) {
+                ChunkBits U = X[Block];
+                ChunkBits V = X[Block + Half];
+                X[Block] = Prime.add(U, V);
+                X[Block + Half] = Prime.sub(U, V);
+                for (i32 Idx = 1 ; Idx < Half ; ++Idx) {
+                    U = X[Block + Idx];
+                    V = Prime.mul(X[Block + Idx + Half], Prime.sub(0, Roots[N/2 - Idx * Stride]));
+                    X[Block + Idx] = Prime.add(U, V);
+                    X[Block + Idx + Half] = Prime.sub(U, V);
+                }
+            }
+        }
+    }
+
+    /** \return transform length used by mul_chunks_ntt: smallest power of 2 >= An+Bn-1 */
+    inline auto ntt_length(i32 An, i32 Bn) -> i32 {
+        i32 N = 1;
+        while (N < An + Bn - 1) N <<= 1;
+        return N;
+    }
+
+    inline auto mul_ntt_scratch_size(i32 An, i32 Bn) -> i32 {
+        i32 N = ntt_length(An, Bn);
+        return 4 * N + N / 2 + 1;
+    }
+
+    /** \brief  Dst[0..An+Bn) = A[0..An) * B[0..Bn), by number theoretic transforms modulo three primes,
+     *          the results are combined by the chinese remainder theorem (Garner's algorithm)
+     *  \note   Dst must not overlap A or B, A may be B.
+     */
+    inline auto mul_chunks_ntt(ChunkBits *Dst, ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn, ChunkScratch Scratch) -> void {
+        i32 N = ntt_length(An, Bn);
+        bool IsSquare = A == B && An == Bn;
+        ChunkBits *Residues[3] = { Scratch.take(N), Scratch.take(N), Scratch.take(N) };
+        ChunkBits *TransformB = Scratch.take(N);
+        ChunkBits *Roots = Scratch.take(N / 2 + 1);
+
+        for (i32 PrimeIdx = 0 ; PrimeIdx < 3 ; ++PrimeIdx) {
+            NttPrime const& Prime = ntt_prime(PrimeIdx);
+            HardAssert(static_cast<ChunkBits>(N) <= ChunkBits{1} << Prime.MaxLog2);
+            ntt_roots(Roots, N, Prime);
+
+            ChunkBits *X = Residues[PrimeIdx];
+            for (i32 Idx = 0 ; Idx < N ; ++Idx) X[Idx] = Idx < An ? Prime.to_montgomery(A[Idx]) : 0;
+            ntt_forward(X, N, Roots, Prime);
+
+            ChunkBits *Y = X;
+            if (!IsSquare) {
+                Y = TransformB;
+                for (i32 Idx = 0 ; Idx < N ; ++Idx) Y[Idx] = Idx < Bn ? Prime.to_montgomery(B[Idx]) : 0;
+                ntt_forward(Y, N, Roots, Prime);
+            }
+
+            for (i32 Idx = 0 ; Idx < N ; ++Idx) X[Idx] = Prime.mul(X[Idx], Y[Idx]);
+            ntt_inverse(X, N, Roots, Prime);
+
+            //NOTE(##2026 10 18): multiplying the Montgomery form x*2^64 by plain N^-1 gives plain x/N, scaling and conversion in one step
+            ChunkBits Scale = Prime.from_montgomery(Prime.inverse(Prime.to_montgomery(N)));
+            for (i32 Idx = 0 ; Idx < N ; ++Idx) X[Idx] = Prime.mul(X[Idx], Scale);
+        }
+
+        // Garner: x = r0 + p0 * (v1 + p1 * v2)
+        NttPrime const& P0 = ntt_prime(0);
+        NttPrime const& P1 = ntt_prime(1);
+        NttPrime const& P2 = ntt_prime(2);
+        ChunkBits P0InvModP1   = P1.inverse(P1.to_montgomery(P0.P % P1.P));   //Montgomery form, so that P1.mul(x, *) == x * p0^-1 for plain x
+        ChunkBits P0ModP2      = P2.to_montgomery(P0.P % P2.P);
+        ChunkBits P0P1[2] = {};
+        full_mul_chunk(P0.P, P1.P, P0P1);
+        ChunkBits P0P1ModP2    = P2.mul(P2.to_montgomery(P0P1[1]), P2.R2);   //(hi * 2^64 + lo) mod p2, Montgomery form
+        P0P1ModP2              = P2.add(P0P1ModP2, P2.to_montgomery(P0P1[0]));
+        ChunkBits P0P1InvModP2 = P2.inverse(P0P1ModP2);
+
+        ChunkBits Acc[4] = {};  //running sum, its lowest chunk goes to Dst
+        for (i32 Idx = 0 ; Idx < An + Bn ; ++Idx) {
+            if (Idx < An + Bn - 1) {
+                ChunkBits R0 = Residues[0][Idx];
+                ChunkBits V1 = P1.mul(P1.sub(Residues[1][Idx], R0 % P1.P), P0InvModP1);
+                ChunkBits R0P0V1 = P2.add(R0 % P2.P, P2.mul(V1, P0ModP2));
+                ChunkBits V2 = P2.mul(P2.sub(Residues[2][Idx], R0P0V1), P0P1InvModP2);
+
+                ChunkBits X[3] = {};                            //X = r0 + p0 * v1 + p0 * p1 * v2
+                full_mul_chunk(P0.P, V1, X);
+                add_chunk(X, X, 3, R0);
+                ChunkBits Prod[2] = {};
+                full_mul_chunk(P0P1[0], V2, Prod);
+                X[2] += add_chunks(X, X, Prod, 2);
+                full_mul_chunk(P0P1[1], V2, Prod);
+                add_chunks(X + 1, X + 1, Prod, 2);
+
+                ChunkBits Carry = add_chunks(Acc, Acc, X, 3);
+                Acc[3] += Carry;
+            }
+            Dst[Idx] = Acc[0];
+            Acc[0] = Acc[1]; Acc[1] = Acc[2]; Acc[2] = Acc[3]; Acc[3] = 0;
+        }
+    }
+
+    /** \return 1 for schoolbook, 2/3/4 for Toom-2 (Karatsuba)/Toom-3/Toom-4, 5 for NTT,
+     *          0 if A is too long compared to B and gets cut into pieces of B's length instead
+     *  \note   expects An >= Bn
+     */
+    inline auto mul_chunks_algorithm(i32 An, i32 Bn) -> i32 {
+        auto at_least_4 = [](i32 Threshold) { return Threshold < 4 ? 4 : Threshold; };
+        if (Bn >= at_least_4(mul_thresholds.ntt)) return 5;
+        if (Bn < at_least_4(mul_thresholds.karatsuba)) return 1;
+        if (2 * Bn <= An) return 0;
+        if (Bn >= at_least_4(mul_thresholds.toom4)) return 4;
+        if (Bn >= at_least_4(mul_thresholds.toom3)) return 3;
+        return 2;
+    }
+
+    /** \return number of chunks Toom-K takes from the scratch buffer itself (not counting the recursive products)
+     *          for a longer operand of N chunks
+     */
+    inline auto toom_own_scratch_size(i32 N, i32 K) -> i32 {
+        i32 M = (N + K - 1) / K;
+        i32 L = 2 * M + 2;
+        return (2*K - 1) * L + (2*K - 3) * L + L + 6 * (M + 1);
+    }
+
+    /** \return size of the scratch buffer mul_chunks needs, in chunks.
+     *  \note   an upper bound for the current mul_thresholds, it never decreases when the operands get longer.
+     *          every algorithm recurses on operands of at most ceil(N/2)+1 chunks, N being the longer operand, NTT doesn't recurse.
+     */
+    inline auto mul_chunks_scratch_size(i32 An, i32 Bn) -> i32 {
+        i32 N = An > Bn ? An : Bn;
+        i32 Result = 0;
+        while (N >= 4) {
+            i32 Own = N; //cutting A into pieces needs 2 * Bn <= N
+            for (i32 K = 2 ; K <= 4 ; ++K) {
+                i32 Toom = toom_own_scratch_size(N, K);
+                Own = Toom > Own ? Toom : Own;
+            }
+            if (N >= mul_thresholds.ntt) {
+                i32 Ntt = mul_ntt_scratch_size(N, N);
+                Own = Ntt > Own ? Ntt : Own;
+            }
+            Result += Own;
+            N = (N + 1) / 2 + 1;
+        }
+        return Result;
+    }
+
+    inline auto mul_chunks(ChunkBits *Dst, ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn, ChunkScratch Scratch) -> void;
+
+    /** \brief  length of the Idx-th piece of a Count chunks long operand cut into pieces of PieceLength, may be 0 */
+    inline auto toom_piece_length(i32 Count, i32 Idx, i32 PieceLength) -> i32 {
+        i32 Rest = Count - Idx * PieceLength;
+        return Rest < 0 ? 0 : Rest < PieceLength ? Rest : PieceLength;
+    }
+
+    /** \brief  splits X into K pieces x_i of M chunks and sums them up as Even = sum x_i*Point^i for even i, Odd for odd i.
+     *          X(Point) = Even + Odd, X(-Point) = Even - Odd
+     *  \note   Even and Odd have M+1 chunks, enough for Point <= 3, K <= 4
+     */
+    inline auto toom_evaluate_halves(ChunkBits *Even, ChunkBits *Odd, ChunkBits const *X, i32 Xn, i32 M, i32 K, ChunkBits Point) -> void {
+        zero_chunks(Even, M + 1);
+        zero_chunks(Odd, M + 1);
+        ChunkBits Power = 1;
+        for (i32 Idx = 0 ; Idx < K ; ++Idx, Power *= Point) {
+            i32 Len = toom_piece_length(Xn, Idx, M);
+            if (Len == 0) break;
+            ChunkBits *Acc = Idx % 2 ? Odd : Even;
+            ChunkBits Carry = addmul_chunk(Acc, X + Idx * M, Len, Power);
+            add_chunk(Acc + Len, Acc + Len, M + 1 - Len, Carry);
+        }
+    }
+
+    /** \brief  Dst = |Even + Odd| or |Even - Odd|, all Count chunks
+     *  \return whether the value was negative
+     */
+    inline auto toom_evaluate_point(ChunkBits *Dst, ChunkBits const *Even, ChunkBits const *Odd, i32 Count, bool IsNegativePoint) -> bool {
+        if (IsNegativePoint) sub_chunks(Dst, Even, Odd, Count);
+        else                 add_chunks(Dst, Even, Odd, Count);
+        bool IsNegative = Dst[Count-1] >> (CHUNK_WIDTH-1);
+        if (IsNegative) negate_chunks(Dst, Count);
+        return IsNegative;
+    }
+
+    /** \brief  Dst[0..An+Bn) = A[0..An) * B[0..Bn) by Toom-K, K in {2, 3, 4}
+     *  \note   expects An >= Bn > An/2
+     */
+    inline auto mul_chunks_toom(ChunkBits *Dst, ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn, i32 K, ChunkScratch Scratch) -> void {
+        constexpr i32 Points[5] = {1, -1, 2, -2, 3}; //NOTE(##2026 10 18): a positive point always comes right before its negative
+        i32 M = (An + K - 1) / K;   //piece length
+        i32 L = 2 * M + 2;          //length of the products and coefficients
+        i32 CoeffCount = 2*K - 1;
+        i32 PointCount = 2*K - 3;   //not counting 0 and inf
+
+        ChunkBits *C = Scratch.take(CoeffCount * L);    //C + Idx*L: coefficient of x^Idx of the product polynomial
+        ChunkBits *R = Scratch.take(PointCount * L);    //R + Idx*L: product polynomial evaluated at Points[Idx]
+        ChunkBits *T = Scratch.take(L);
+        ChunkBits *EvenA = Scratch.take(M + 1);
+        ChunkBits *OddA  = Scratch.take(M + 1);
+        ChunkBits *EvenB = Scratch.take(M + 1);
+        ChunkBits *OddB  = Scratch.take(M + 1);
+        ChunkBits *ValA  = Scratch.take(M + 1);
+        ChunkBits *ValB  = Scratch.take(M + 1);
+
+        // evaluate at 0 and inf, i.e. multiply the lowest and the highest pieces
+        i32 LenB0 = toom_piece_length(Bn, 0, M);
+        mul_chunks(C, A, M, B, LenB0, Scratch);
+        zero_chunks(C + M + LenB0, L - M - LenB0);
+
+        ChunkBits *CInf = C + (CoeffCount-1) * L;
+        i32 LenATop = toom_piece_length(An, K-1, M);
+        i32 LenBTop = toom_piece_length(Bn, K-1, M);
+        if (LenATop && LenBTop) {
+            mul_chunks(CInf, A + (K-1) * M, LenATop, B + (K-1) * M, LenBTop, Scratch);
+            zero_chunks(CInf + LenATop + LenBTop, L - LenATop - LenBTop);
+        }
+        else {
+            zero_chunks(CInf, L);
+        }
+
+        // evaluate at the remaining points
+        for (i32 Idx = 0 ; Idx < PointCount ; ++Idx) {
+            i32 Point = Points[Idx];
+            if (Point > 0) {
+                toom_evaluate_halves(EvenA, OddA, A, An, M, K, Point);
+                toom_evaluate_halves(EvenB, OddB, B, Bn, M, K, Point);
+            }
+            bool IsNegativeA = toom_evaluate_point(ValA, EvenA, OddA, M + 1, Point < 0);
+            bool IsNegativeB = toom_evaluate_point(ValB, EvenB, OddB, M + 1, Point < 0);
+            mul_chunks(R + Idx * L, ValA, M + 1, ValB, M + 1, Scratch);
+            if (IsNegativeA != IsNegativeB) negate_chunks(R + Idx * L, L);
+        }
+
+        // interpolate
+        auto add    = [L](ChunkBits *X, ChunkBits const *Y) { add_chunks(X, X, Y, L); };
+        auto sub    = [L](ChunkBits *X, ChunkBits const *Y) { sub_chunks(X, X, Y, L); };
+        auto submul = [L, T](ChunkBits *X, ChunkBits const *Y, ChunkBits Factor) { mul_chunk(T, Y, L, Factor); sub_chunks(X, X, T, L); };
+        auto sar    = [L](ChunkBits *X, u32 Offset) { shift_right_signed_chunks(X, L, Offset); };
+        auto divexact = [L](ChunkBits *X, ChunkBits Divisor) { divexact_chunks(X, L, Divisor); };
+        auto coeff  = [C, L](i32 Idx) { return C + Idx * L; };
+        auto value  = [R, L](i32 Idx) { return R + Idx * L; };
+
+        if (K == 2) {
+            // c1 = r(1) - c0 - c2
+            copy_chunks(coeff(1), value(0), L);
+            sub(coeff(1), coeff(0));
+            sub(coeff(1), coeff(2));
+        }
+        else if (K == 3) {
+            // v(x) = r(x) - c0 - c4*x^4 = c1*x + c2*x^2 + c3*x^3
+            for (i32 Idx = 0 ; Idx < 3 ; ++Idx) sub(value(Idx), coeff(0));
+            sub(value(0), coeff(4));
+            sub(value(1), coeff(4));
+            submul(value(2), coeff(4), 16);
+
+            copy_chunks(coeff(2), value(0), L);     // c2 = (v(1) + v(-1)) / 2
+            add(coeff(2), value(1));
+            sar(coeff(2), 1);
+            sub(value(0), value(1));                // c1 + c3 = (v(1) - v(-1)) / 2
+            sar(value(0), 1);
+            submul(value(2), coeff(2), 4);          // c1 + 4*c3 = (v(2) - 4*c2) / 2
+            sar(value(2), 1);
+            copy_chunks(coeff(3), value(2), L);     // c3 = ((c1 + 4*c3) - (c1 + c3)) / 3
+            sub(coeff(3), value(0));
+            divexact(coeff(3), 3);
+            copy_chunks(coeff(1), value(0), L);     // c1 = (c1 + c3) - c3
+            sub(coeff(1), coeff(3));
+        }
+        else {
+            // v(x) = r(x) - c0 - c6*x^6 = c1*x + ... + c5*x^5
+            for (i32 Idx = 0 ; Idx < 5 ; ++Idx) sub(value(Idx), coeff(0));
+            sub(value(0), coeff(6));
+            sub(value(1), coeff(6));
+            submul(value(2), coeff(6), 64);
+            submul(value(3), coeff(6), 64);
+            submul(value(4), coeff(6), 729);
+
+            copy_chunks(coeff(2), value(0), L);     // E1 = c2 + c4 = (v(1) + v(-1)) / 2
+            add(coeff(2), value(1));
+            sar(coeff(2), 1);
+            sub(value(0), value(1));                // O1 = c1 + c3 + c5 = (v(1) - v(-1)) / 2
+            sar(value(0), 1);
+            copy_chunks(coeff(4), value(2), L);     // E2 = c2 + 4*c4 = (v(2) + v(-2)) / 8
+            add(coeff(4), value(3));
+            sar(coeff(4), 3);
+            sub(value(2), value(3));                // O2 = c1 + 4*c3 + 16*c5 = (v(2) - v(-2)) / 4
+            sar(value(2), 2);
+
+            sub(coeff(4), coeff(2));                // c4 = (E2 - E1) / 3
+            divexact(coeff(4), 3);
+            sub(coeff(2), coeff(4));                // c2 = E1 - c4
+
+            submul(value(4), coeff(2), 9);          // W = c1 + 9*c3 + 81*c5 = (v(3) - 9*c2 - 81*c4) / 3
+            submul(value(4), coeff(4), 81);
+            divexact(value(4), 3);
+            sub(value(2), value(0));                // D1 = c3 + 5*c5 = (O2 - O1) / 3
+            divexact(value(2), 3);
+            sub(value(4), value(0));                // D2 = c3 + 10*c5 = (W - O1) / 8
+            sar(value(4), 3);
+
+            copy_chunks(coeff(5), value(4), L);     // c5 = (D2 - D1) / 5
+            sub(coeff(5), value(2));
+            divexact(coeff(5), 5);
+            copy_chunks(coeff(3), value(2), L);     // c3 = D1 - 5*c5
+            submul(coeff(3), coeff(5), 5);
+            copy_chunks(coeff(1), value(0), L);     // c1 = O1 - c3 - c5
+            sub(coeff(1), coeff(3));
+            sub(coeff(1), coeff(5));
+        }
+
+        // recompose: Dst = sum c_Idx * 2^(Idx*M*CHUNK_WIDTH)
+        zero_chunks(Dst, An + Bn);
+        for (i32 Idx = 0 ; Idx < CoeffCount ; ++Idx) {
+            add_chunks_at(Dst, An + Bn, Idx * M, coeff(Idx), L);
+        }
+    }
+
+    /** \brief  Dst[0..An+Bn) = A[0..An) * B[0..Bn)
+     *  \note   Dst must not overlap A or B, A may be B.
+     *          Scratch needs at least mul_chunks_scratch_size(An, Bn) chunks
+     */
+    inline auto mul_chunks(ChunkBits *Dst, ChunkBits const *A, i32 An, ChunkBits const *B, i32 Bn, ChunkScratch Scratch) -> void {
+        if (An < Bn) {
+            ChunkBits const *Swap = A; A = B; B = Swap;
+            i32 SwapN = An; An = Bn; Bn = SwapN;
+        }
+        if (Bn == 0) {
+            zero_chunks(Dst, An);
+            return;
+        }
+
+        i32 Algorithm = mul_chunks_algorithm(An, Bn);
+        if (Algorithm == 1) {
+            mul_chunks_basecase(Dst, A, An, B, Bn);
+        }
+        else if (Algorithm == 0) {
+            // A is much longer than B: multiply B with pieces of A of B's length, add up the partial products
+            mul_chunks(Dst, A, Bn, B, Bn, Scratch);
+            zero_chunks(Dst + 2 * Bn, An - Bn);
+            ChunkBits *Partial = Scratch.take(2 * Bn);
+            for (i32 Offset = Bn ; Offset < An ; Offset += Bn) {
+                i32 Len = toom_piece_length(An - Offset, 0, Bn);
+                mul_chunks(Partial, A + Offset, Len, B, Bn, Scratch);
+                add_chunks_at(Dst, An + Bn, Offset, Partial, Len + Bn);
+            }
+        }
+        else if (Algorithm == 5) {
+            mul_chunks_ntt(Dst, A, An, B, Bn, Scratch);
+        }
+        else {
+            mul_chunks_toom(Dst, A, An, B, Bn, Algorithm, Scratch);
+        }
+    }
+}
+
+
+/* Chunk array division
+ * Knuth's Algorithm D (TAOCP Vol. 2, 4.3.1), one quotient chunk per step, with a separate path for single-chunk divisors.
+ * for long divisors and quotients: the reciprocal of the divisor by Newton iteration, then Barrett reduction,
+ * i.e. the division costs a few multiplications.
+ */
+namespace BigDecimal_ {
+
+    /** \brief  (High * 2^CHUNK_WIDTH + Low) / Divisor, for a normalized divisor (top bit set) and High < Divisor
+     *  \return the quotient, which fits a chunk because of High < Divisor
+     *  \note   schoolbook division on half chunks, see Hacker's Delight, divlu
+     */
+    inline auto div_2by1(ChunkBits High, ChunkBits Low, ChunkBits Divisor, ChunkBits *Remainder) -> ChunkBits {
+        HardAssert(High < Divisor && (Divisor >> (CHUNK_WIDTH-1)));
+#if defined(BIG_DECIMAL_X64_LIMBS) && defined(_MSC_VER) && !defined(__clang__)
+        unsigned long long Rem;
+        ChunkBits Quotient = _udiv128(High, Low, Divisor, &Rem);
+        *Remainder = Rem;
+        return Quotient;
+#elif defined(BIG_DECIMAL_X64_LIMBS)
+        //NOTE(##2026 10 18): a single divq, High < Divisor so the quotient can't overflow
+        ChunkBits Quotient, Rem;
+        __asm__("divq %[Divisor]" : "=a"(Quotient), "=d"(Rem) : [Divisor] "rm"(Divisor), "a"(Low), "d"(High));
+        *Remainder = Rem;
+        return Quotient;
+#else
+        constexpr u32 HalfWidth = CHUNK_WIDTH / 2;
+        constexpr ChunkBits HalfBase = (ChunkBits)1 << HalfWidth;
+        constexpr ChunkBits HalfMask = HalfBase - 1;
+
+        ChunkBits DivisorHigh = Divisor >> HalfWidth;
+        ChunkBits DivisorLow  = Divisor & HalfMask;
+        ChunkBits LowHigh = Low >> HalfWidth;
+        ChunkBits LowLow  = Low & HalfMask;
+
+        ChunkBits QuotientHigh = High / DivisorHigh;
+        ChunkBits RemainderHat = High - QuotientHigh * DivisorHigh;
+        while (QuotientHigh >= HalfBase || QuotientHigh * DivisorLow > (RemainderHat << HalfWidth) + LowHigh) {
+            --QuotientHigh;
+            RemainderHat += DivisorHigh;
+            if (RemainderHat >= HalfBase) break;
+        }
+
+        ChunkBits Middle = (High << HalfWidth) + LowHigh - QuotientHigh * Divisor;
+
+        ChunkBits QuotientLow = Middle / DivisorHigh;
+        RemainderHat = Middle - QuotientLow * DivisorHigh;
+        while (QuotientLow >= HalfBase || QuotientLow * DivisorLow > (RemainderHat << HalfWidth) + LowLow) {
+            --QuotientLow;
+            RemainderHat += DivisorHigh;
+            if (RemainderHat >= HalfBase) break;
+        }
+
+        *Remainder = (Middle << HalfWidth) + LowLow - QuotientLow * Divisor;
+        return (QuotientHigh << HalfWidth) + QuotientLow;
+#endif
+    }
+
+    /** \brief  Quotient[0..Count) = A[0..Count) / Divisor
+     *  \return the remainder
+     *  \note   Quotient may be A
+     */
+    inline auto div_chunk(ChunkBits *Quotient, ChunkBits const *A, i32 Count, ChunkBits Divisor) -> ChunkBits {
+        HardAssert(Divisor != 0x0);
+        u32 Shift = leading_zeros(Divisor);
+        ChunkBits Normalized = Divisor << Shift;
+        ChunkBits Remainder = Shift ? A[Count-1] >> (CHUNK_WIDTH - Shift) : 0x0;
+        for (i32 Idx = Count-1 ; Idx >= 0 ; --Idx) {
+            ChunkBits Low = A[Idx] << Shift;
+            if (Shift && Idx > 0) Low |= A[Idx-1] >> (CHUNK_WIDTH - Shift);
+            Quotient[Idx] = div_2by1(Remainder, Low, Normalized, &Remainder);
+        }
+        return Remainder >> Shift;
+    }
+
+    /** \brief  Wide[0..WideCount) = Src[0..Count) * 2^Shift
+     *  \note   needs Shift + the bit width of Src[0..Count) <= WideCount*CHUNK_WIDTH
+     */
+    inline auto widen_chunks(ChunkBits const *Src, i32 Count, i32 Shift, ChunkBits *Wide, i32 WideCount) -> void {
+        i32 Whole = Shift / CHUNK_WIDTH;
+        u32 Bits = static_cast<u32>(Shift % CHUNK_WIDTH);
+        for (i32 Idx = 0 ; Idx < WideCount ; ++Idx) Wide[Idx] = 0x0;
+        for (i32 Idx = 0 ; Idx < Count && Idx + Whole < WideCount ; ++Idx) {
+            Wide[Idx + Whole] |= Src[Idx] << Bits;
+            if (Bits && Idx + Whole + 1 < WideCount) Wide[Idx + Whole + 1] |= Src[Idx] >> (CHUNK_WIDTH - Bits);
+        }
+    }
+
+    inline auto div_knuth_scratch_size(i32 An, i32 Bn) -> i32 {
+        return An + 1 + Bn;
+    }
+
+    /** \brief  Quotient[0..An-Bn+1) = A[0..An) / B[0..Bn), A[0..Bn) = remainder, A[Bn..An) = 0
+     *  \note   needs An >= Bn and a non-zero top chunk of B. Quotient must not overlap A or B.
+     *          Scratch needs at least div_knuth_scratch_size(An, Bn) chunks
+     */
+    inline auto div_chunks_knuth(ChunkBits *Quotient, ChunkBits *A, i32 An, ChunkBits const *B, i32 Bn, ChunkScratch Scratch) -> void {
+        HardAssert(An >= Bn && B[Bn-1] != 0x0);
+
+        if (Bn == 1) {
+            A[0] = div_chunk(Quotient, A, An, B[0]);
+            zero_chunks(A + 1, An - 1);
+            return;
+        }
+
+        // D1: normalize, so that the top bit of the divisor is set. this keeps every guess of a quotient chunk at most 2 too big
+        u32 Shift = leading_zeros(B[Bn-1]);
+        ChunkBits *U = Scratch.take(An + 1);
+        ChunkBits *V = Scratch.take(Bn);
+        shift_left_chunks(V, B, Bn, Shift);
+        U[An] = shift_left_chunks(U, A, An, Shift);
+
+        ChunkBits VTop = V[Bn-1];
+        ChunkBits VNext = V[Bn-2];
+        for (i32 J = An - Bn ; J >= 0 ; --J) {
+            // D3: guess the quotient chunk from the top two chunks of the remainder and the top chunk of the divisor
+            ChunkBits QHat, RHat;
+            bool RHatOverflow = false;
+            if (U[J+Bn] >= VTop) {
+                QHat = MAX_CHUNK_VAL;
+                RHat = U[J+Bn-1] + VTop;
+                RHatOverflow = RHat < VTop;
+            }
+            else {
+                QHat = div_2by1(U[J+Bn], U[J+Bn-1], VTop, &RHat);
+            }
+            // refine with the next divisor chunk: QHat * VNext > RHat * 2^CHUNK_WIDTH + U[J+Bn-2] means QHat is too big
+            while (!RHatOverflow) {
+                ChunkBits Prod[2] = {};
+                full_mul_chunk(QHat, VNext, Prod);
+                if (Prod[1] < RHat || (Prod[1] == RHat && Prod[0] <= U[J+Bn-2])) break;
+                --QHat;
+                RHat += VTop;
+                RHatOverflow = RHat < VTop;
+            }
+
+            // D4: multiply and subtract
+            ChunkBits Borrow = submul_chunk(U + J, V, Bn, QHat);
+            bool IsNegative = U[J+Bn] < Borrow;
+            U[J+Bn] -= Borrow;
+
+            // D6: add back, happens with a probability of about 2/2^CHUNK_WIDTH
+            if (IsNegative) {
+                --QHat;
+                U[J+Bn] += add_chunks(U + J, U + J, V, Bn);
+            }
+            Quotient[J] = QHat;
+        }
+
+        // D8: unnormalize the remainder
+        shift_right_chunks(A, U, Bn, Shift);
+        zero_chunks(A + Bn, An - Bn);
+    }
+
+    /** \brief  size of the divisor and of the quotient (in chunks) from which on div_chunks uses Newton/Barrett instead of Knuth.
+     *  \note   both must reach the threshold. the best value depends on the machine, tune it through BigDecimal_::div_thresholds.
+     */
+    struct DivThresholds {
+        i32 newton = 1024;
+    };
+
+    inline DivThresholds div_thresholds {};
+
+    /** \return 1 for Knuth's Algorithm D, 2 for Newton reciprocal and Barrett reduction */
+    inline auto div_chunks_algorithm(i32 An, i32 Bn) -> i32 {
+        i32 Qn = An - Bn + 1;
+        i32 Threshold = div_thresholds.newton < 2 ? 2 : div_thresholds.newton;
+        return Bn >= Threshold && Qn >= Threshold ? 2 : 1;
+    }
+
+    constexpr i32 RECIPROCAL_BASECASE_CHUNKS = 8;
+
+    /** \return whether the two's complement value R[0..Count) is negative */
+    inline auto is_negative_chunks(ChunkBits const *R, i32 Count) -> bool {
+        return R[Count-1] >> (CHUNK_WIDTH-1);
+    }
+
+    /** \brief  X[0..K+1) = floor(2^(2*K*CHUNK_WIDTH) / D[0..K)), D's top bit must be set.
+     *  \note   one Newton step X += X * (2^(2*K*CHUNK_WIDTH) - D*X) / 2^(2*K*CHUNK_WIDTH),
+     *          starting from the reciprocal of the top K/2+2 chunks of D, then corrected to the exact floor.
+     */
+    inline auto reciprocal_chunks(ChunkBits *X, ChunkBits const *D, i32 K, ChunkScratch Scratch) -> void {
+        HardAssert(D[K-1] >> (CHUNK_WIDTH-1));
+
+        if (K <= RECIPROCAL_BASECASE_CHUNKS) {
+            ChunkBits *U = Scratch.take(2*K + 1);
+            ChunkBits *Q = Scratch.take(K + 2);
+            zero_chunks(U, 2*K);
+            U[2*K] = 0x1;
+            div_chunks_knuth(Q, U, 2*K + 1, D, K, Scratch);
+            copy_chunks(X, Q, K + 1);
+            return;
+        }
+
+        // X0 = reciprocal of the top H chunks, moved up by K-H chunks
+        i32 H = K/2 + 2;
+        ChunkBits *XH = Scratch.take(H + 1);
+        reciprocal_chunks(XH, D + K - H, H, Scratch);
+        zero_chunks(X, K - H);
+        copy_chunks(X + K - H, XH, H + 1);
+
+        // E = 2^(2*K*CHUNK_WIDTH) - D*X0, two's complement over 2K+2 chunks
+        i32 En = 2*K + 2;
+        ChunkBits *E = Scratch.take(En);
+        zero_chunks(E, K - H);
+        mul_chunks(E + K - H, D, K, XH, H + 1, Scratch);
+        E[En-1] = 0x0;
+        negate_chunks(E, En);
+        add_chunk(E + 2*K, E + 2*K, 2, 0x1);
+        bool IsNegativeE = is_negative_chunks(E, En);
+        if (IsNegativeE) negate_chunks(E, En);
+        En = significant_chunks(E, En);
+
+        // X = X0 +- X0*|E| / 2^(2*K*CHUNK_WIDTH) == X0 +- XH*|E| / 2^((K+H)*CHUNK_WIDTH)
+        ChunkBits *T = Scratch.take(H + 1 + En);
+        mul_chunks(T, XH, H + 1, E, En, Scratch);
+        i32 Tn = H + 1 + En - (K + H);
+        if (Tn > 0) {
+            Tn = Tn < K + 1 ? Tn : K + 1;
+            if (IsNegativeE) sub_chunk(X + Tn, X + Tn, K + 1 - Tn, sub_chunks(X, X, T + K + H, Tn));
+            else             add_chunk(X + Tn, X + Tn, K + 1 - Tn, add_chunks(X, X, T + K + H, Tn));
+        }
+
+        // R = 2^(2*K*CHUNK_WIDTH) - D*X must end up in [0, D)
+        i32 Rn = 2*K + 2;
+        ChunkBits *R = Scratch.take(Rn);
+        mul_chunks(R, D, K, X, K + 1, Scratch);
+        R[Rn-1] = 0x0;
+        negate_chunks(R, Rn);
+        add_chunk(R + 2*K, R + 2*K, 2, 0x1);
+        while (is_negative_chunks(R, Rn)) {
+            sub_chunk(X, X, K + 1, 0x1);
+            add_chunk(R + K, R + K, Rn - K, add_chunks(R, R, D, K));
+        }
+        while (significant_chunks(R + K, Rn - K) > 1 || R[K] != 0x0 || compare_chunks(R, D, K) >= 0) {
+            add_chunk(X, X, K + 1, 0x1);
+            sub_chunk(R + K, R + K, Rn - K, sub_chunks(R, R, D, K));
+        }
+    }
+
+    /** \brief  Q[0..N) = Num[0..2N) / B[0..N), R[0..N) = remainder, by Barrett reduction with X = floor(2^(2*N*CHUNK_WIDTH) / B)
+     *  \note   needs Num < B * 2^(N*CHUNK_WIDTH) and B's top bit set
+     */
+    inline auto div_barrett_step(ChunkBits *Q, ChunkBits *R, ChunkBits const *Num, ChunkBits const *B, ChunkBits const *X, i32 N, ChunkScratch Scratch) -> void {
+        // estimate Q3 = ((Num >> (N-1) chunks) * X) >> (N+1) chunks, which is at most 2 too small (HAC 14.42)
+        //NOTE(##2026 10 18): operands are trimmed to their significant chunks, which makes blocks with small quotients cheap
+        ChunkBits *Q2 = Scratch.take(2*N + 2);
+        i32 Q1n = significant_chunks(Num + N - 1, N + 1);
+        mul_chunks(Q2, Num + N - 1, Q1n, X, N + 1, Scratch);
+        zero_chunks(Q2 + Q1n + N + 1, N + 1 - Q1n);
+        ChunkBits *Q3 = Q2 + N + 1;
+        HardAssert(Q3[N] == 0x0);
+
+        ChunkBits *Rem = Scratch.take(2*N);
+        i32 Q3n = significant_chunks(Q3, N);
+        mul_chunks(Rem, Q3, Q3n, B, N, Scratch);
+        zero_chunks(Rem + Q3n + N, N - Q3n);
+        sub_chunks(Rem, Num, Rem, 2*N);
+        while (significant_chunks(Rem + N, N) > 1 || Rem[N] != 0x0 || compare_chunks(Rem, B, N) >= 0) {
+            add_chunk(Q3, Q3, N, 0x1);
+            sub_chunk(Rem + N, Rem + N, N, sub_chunks(Rem, Rem, B, N));
+        }
+        copy_chunks(Q, Q3, N);
+        copy_chunks(R, Rem, N);
+    }
+
+    /** \return size of the scratch buffer div_chunks_newton needs, in chunks, for An >= Bn.
+     *  \note   callees get the scratch by value, so a call needs what the caller has taken so far plus the callee's peak.
+     *          M(n) = mul_chunks_scratch_size(n, n) never decreases, and no product below has an operand longer than 2Bn+2.
+     *          div_barrett_step(N): Q2 2N+2, Rem 2N, products of at most N+1 chunks -> 4N+2 + M(N+1).
+     *          reciprocal_chunks(K), H = K/2+2: the base case (K <= 8) takes 3K+3 and Knuth 3K+2 -> 6K+5.
+     *              above it XH H+1, E 2K+2, T <= 2K+H+3, R 2K+2, products of at most 2K+2 chunks -> 6K+2H+8 + M(2K+2),
+     *              the recursion H+1 + R(H) stays below that for K > 8, so R(K) <= 8K+16 + M(2K+2).
+     *          div_chunks_newton: BShifted Bn, AShifted An+1, then
+     *              Qn < Bn, K = Qn+1 <= Bn: X K+1, then R(K), or Num, Q, R 4K and Rem, Tmp 2(An+1)
+     *                  -> <= An+Bn+K+2 + 8K+2An+16 + M(2Bn+2) <= 3An+10Bn+18 + M(2Bn+2)
+     *              Qn >= Bn: X Bn+1, then R(Bn), or Padded, Q <= An+Bn each, Num 2Bn and a Barrett step of N = Bn
+     *                  -> <= An+2Bn+2 + 2An+8Bn+16 + M(2Bn+2) = 3An+10Bn+18 + M(2Bn+2)
+     */
+    inline auto div_newton_scratch_size(i32 An, i32 Bn) -> i32 {
+        return 3 * An + 10 * Bn + 18 + mul_chunks_scratch_size(2 * Bn + 2, 2 * Bn + 2);
+    }
+
+    /** \brief  same contract as div_chunks_knuth, by Newton reciprocal and Barrett reduction.
+     *  \note   if the quotient is shorter than the divisor, only the top Qn+1 chunks of the divisor go into the reciprocal,
+     *          that estimate is at most 2 too big and is corrected against the whole divisor.
+     *          otherwise the dividend is consumed in blocks of Bn chunks, each yields Bn chunks of the quotient.
+     *          Scratch needs at least div_newton_scratch_size(An, Bn) chunks
+     */
+    inline auto div_chunks_newton(ChunkBits *Quotient, ChunkBits *A, i32 An, ChunkBits const *B, i32 Bn, ChunkScratch Scratch) -> void {
+        HardAssert(An >= Bn && B[Bn-1] != 0x0);
+        HardAssert(Scratch.End - Scratch.Next >= div_newton_scratch_size(An, Bn)); //NOTE(##2026 10 18): ChunkScratch::take checks every buffer against the end
+
+        u32 Shift = leading_zeros(B[Bn-1]);
+        ChunkBits *BShifted = Scratch.take(Bn);
+        shift_left_chunks(BShifted, B, Bn, Shift);
+        i32 Ln = An + 1;
+        ChunkBits *AShifted = Scratch.take(Ln);
+        AShifted[An] = shift_left_chunks(AShifted, A, An, Shift);
+
+        i32 Qn = An - Bn + 1;
+        ChunkBits *Remainder = nullptr;
+
+        if (Qn < Bn) {
+            i32 K = Qn + 1;
+            i32 Dropped = Bn - K;
+            ChunkBits *X = Scratch.take(K + 1);
+            reciprocal_chunks(X, BShifted + Dropped, K, Scratch);
+
+            ChunkBits *Num = Scratch.take(2*K);
+            copy_chunks(Num, AShifted + Dropped, 2*K - 1);
+            Num[2*K - 1] = 0x0;
+            ChunkBits *Q = Scratch.take(K);
+            ChunkBits *R = Scratch.take(K);
+            div_barrett_step(Q, R, Num, BShifted + Dropped, X, K, Scratch);
+
+            // Rem = AShifted - Q * BShifted, two's complement over Ln+1 chunks
+            ChunkBits *Rem = Scratch.take(Ln + 1);
+            mul_chunks(Rem, Q, K, BShifted, Bn, Scratch);
+            ChunkBits *Tmp = Scratch.take(Ln + 1);
+            copy_chunks(Tmp, AShifted, Ln);
+            Tmp[Ln] = 0x0;
+            sub_chunks(Rem, Tmp, Rem, Ln + 1);
+            while (is_negative_chunks(Rem, Ln + 1)) {
+                sub_chunk(Q, Q, K, 0x1);
+                add_chunk(Rem + Bn, Rem + Bn, Ln + 1 - Bn, add_chunks(Rem, Rem, BShifted, Bn));
+            }
+            HardAssert(Q[K-1] == 0x0);
+            copy_chunks(Quotient, Q, Qn);
+            Remainder = Rem;
+        }
+        else {
+            ChunkBits *X = Scratch.take(Bn + 1);
+            reciprocal_chunks(X, BShifted, Bn, Scratch);
+
+            i32 Blocks = (Ln + Bn - 1) / Bn;
+            ChunkBits *Padded = Scratch.take(Blocks * Bn);
+            copy_chunks(Padded, AShifted, Ln);
+            zero_chunks(Padded + Ln, Blocks * Bn - Ln);
+            ChunkBits *Q = Scratch.take(Blocks * Bn);
+            ChunkBits *Num = Scratch.take(2*Bn);
+            zero_chunks(Num + Bn, Bn);
+            if (Ln % Bn) {
+                //NOTE(##2026 10 18): a partial top block is shorter than B, i.e. already a remainder
+                --Blocks;
+                copy_chunks(Num + Bn, Padded + Blocks * Bn, Bn);
+                zero_chunks(Q + Blocks * Bn, Bn);
+            }
+            for (i32 Block = Blocks - 1 ; Block >= 0 ; --Block) {
+                copy_chunks(Num, Padded + Block * Bn, Bn);
+                div_barrett_step(Q + Block * Bn, Num + Bn, Num, BShifted, X, Bn, Scratch);
+            }
+            copy_chunks(Quotient, Q, Qn);
+            Remainder = Num + Bn;
+        }
+
+        shift_right_chunks(A, Remainder, Bn, Shift);
+        zero_chunks(A + Bn, An - Bn);
+    }
+
+    inline auto div_chunks_scratch_size(i32 An, i32 Bn) -> i32 {
+        return div_chunks_algorithm(An, Bn) == 2 ? div_newton_scratch_size(An, Bn) : div_knuth_scratch_size(An, Bn);
+    }
+
+    /** \brief  Quotient[0..An-Bn+1) = A[0..An) / B[0..Bn), A[0..Bn) = remainder, A[Bn..An) = 0
+     *  \note   needs An >= Bn and a non-zero top chunk of B. Quotient must not overlap A or B.
+     *          picks Knuth or Newton by div_thresholds, Scratch needs at least div_chunks_scratch_size(An, Bn) chunks
+     */
+    inline auto div_chunks(ChunkBits *Quotient, ChunkBits *A, i32 An, ChunkBits const *B, i32 Bn, ChunkScratch Scratch) -> void {
+        if (div_chunks_algorithm(An, Bn) == 2) {
+            div_chunks_newton(Quotient, A, An, B, Bn, Scratch);
+        }
+        else {
+            div_chunks_knuth(Quotient, A, An, B, Bn, Scratch);
+        }
+    }
+}
+
+
+/* Decimal conversion of chunk arrays
+ * decimal digits are first packed into "decimal chunks" of 19 digits each (base 10^19, the largest power of ten below 2^64).
+ * short runs of decimal chunks are converted by Horner's scheme, long runs by divide and conquer:
+ *     value = high half * 10^(19*2^K) + low half, the powers 10^(19*2^K) are kept in a table and reused across calls.
+ * printing goes the other way: long numbers are split by division through the same table entries, short ones by dividing by 10^19.
+ */
+namespace BigDecimal_ {
+
+    constexpr i32 DECIMAL_CHUNK_DIGITS = 19;
+    constexpr ChunkBits DECIMAL_CHUNK_BASE = 10000000000000000000ull;
+
+    /** \brief  number of decimal chunks from which on the conversions go divide and conquer instead of Horner (parse)
+     *          or repeated division by 10^19 (print).
+     *  \note   the best values depend on the machine, tune them through BigDecimal_::radix_thresholds.
+     *          values below 2 are treated as 2.
+     */
+    struct RadixThresholds {
+        i32 parse = 32;
+        i32 print = 32;
+    };
+
+    inline RadixThresholds radix_thresholds {};
+
+    /** \brief  layouts of to_decimal_chars, see there */
+    enum class DecimalFormat {
+        FIXED,
+        SCIENTIFIC,
+        SHORTEST
+    };
+
+    /** \brief  power table layout: 10^(19*2^Level) sits at Table[2^Level-1 .. 2^(Level+1)-1), i.e. 2^Level chunks, high ones may be zero.
+     *  \return size of a table with Levels levels, in chunks
+     */
+    inline auto decimal_power_table_size(i32 Levels) -> i32 {
+        return (1 << Levels) - 1;
+    }
+
+    inline auto decimal_power(ChunkBits const *Table, i32 Level) -> ChunkBits const* {
+        return Table + (1 << Level) - 1;
+    }
+
+    /** \return number of table levels a conversion of Count decimal chunks uses, for one of the radix_thresholds */
+    inline auto decimal_power_levels(i32 Count, i32 Threshold) -> i32 {
+        Threshold = Threshold < 2 ? 2 : Threshold;
+        i32 Levels = 0;
+        if (Count > Threshold) {
+            while ((1 << Levels) < Count) ++Levels;
+        }
+        return Levels;
+    }
+
+    /** \return size of the scratch buffer fill_decimal_power_table needs, in chunks */
+    inline auto decimal_power_table_scratch_size(i32 Levels) -> i32 {
+        return Levels < 2 ? 0 : mul_chunks_scratch_size(1 << (Levels-2), 1 << (Levels-2));
+    }
+
+    /** \brief  computes the levels [From, To) of a power table whose levels below From are already there.
+     *  \note   Scratch needs at least decimal_power_table_scratch_size(To) chunks
+     */
+    inline auto fill_decimal_power_table(ChunkBits *Table, i32 From, i32 To, ChunkScratch Scratch) -> void {
+        for (i32 Level = From ; Level < To ; ++Level) {
+            ChunkBits *Dst = Table + (1 << Level) - 1;
+            if (Level == 0) {
+                Dst[0] = DECIMAL_CHUNK_BASE;
+                continue;
+            }
+            i32 HalfLength = 1 << (Level-1);
+            ChunkBits const *Half = decimal_power(Table, Level-1);
+            i32 Hn = significant_chunks(Half, HalfLength);
+            mul_chunks(Dst, Half, Hn, Half, Hn, Scratch);
+            zero_chunks(Dst + 2 * Hn, 2 * (HalfLength - Hn));
+        }
+    }
+
+    /** \return number of chunks of 10^Exponent as written by decimal_power_chunks, high ones may be zero */
+    inline auto decimal_power_length(i32 Exponent) -> i32 {
+        return Exponent / DECIMAL_CHUNK_DIGITS + 1;
+    }
+
+    /** \return number of table levels decimal_power_chunks uses for 10^Exponent */
+    inline auto decimal_power_chunks_levels(i32 Exponent) -> i32 {
+        i32 Blocks = Exponent / DECIMAL_CHUNK_DIGITS;
+        i32 Levels = 0;
+        while ((1 << Levels) <= Blocks) ++Levels;
+        return Levels;
+    }
+
+    /** \return size of the scratch buffer decimal_power_chunks needs, in chunks */
+    inline auto decimal_power_chunks_scratch_size(i32 Exponent) -> i32 {
+        i32 Length = decimal_power_length(Exponent);
+        return Length + mul_chunks_scratch_size(Length, Length);
+    }
+
+    /** \brief  Dst[0..decimal_power_length(Exponent)) = 10^Exponent, as product of the table entries picked by the bits of Exponent/19.
+     *  \note   Table needs decimal_power_chunks_levels(Exponent) levels, Scratch at least decimal_power_chunks_scratch_size(Exponent) chunks
+     */
+    inline auto decimal_power_chunks(ChunkBits *Dst, i32 Exponent, ChunkBits const *Table, ChunkScratch Scratch) -> void {
+        i32 Length = decimal_power_length(Exponent);
+        i32 Blocks = Exponent / DECIMAL_CHUNK_DIGITS;
+
+        ChunkBits Small = 1;
+        for (i32 Idx = Blocks * DECIMAL_CHUNK_DIGITS ; Idx < Exponent ; ++Idx) Small *= 10;
+
+        // the partial products alternate between Dst and Other, start where the last one has to end up
+        i32 Factors = 0;
+        for (i32 Bits = Blocks ; Bits ; Bits >>= 1) Factors += Bits & 1;
+        ChunkBits *Other = Scratch.take(Length);
+        ChunkBits *Cur = Factors % 2 == 0 ? Dst : Other;
+        ChunkBits *Next = Factors % 2 == 0 ? Other : Dst;
+
+        Cur[0] = Small;
+        i32 Cn = 1;
+        for (i32 Level = 0 ; (Blocks >> Level) != 0 ; ++Level) {
+            if (((Blocks >> Level) & 1) == 0) continue;
+            ChunkBits const *Power = decimal_power(Table, Level);
+            i32 Pn = significant_chunks(Power, 1 << Level);
+            mul_chunks(Next, Cur, Cn, Power, Pn, Scratch);
+            Cn = significant_chunks(Next, Cn + Pn);
+            ChunkBits *Swap = Cur; Cur = Next; Next = Swap;
+        }
+        zero_chunks(Dst + Cn, Length - Cn);
+    }
+
+    /** \brief  packs a run of decimal digits into decimal chunks, least significant first.
+     *  \return number of decimal chunks written, ceil(DigitCount/19)
+     */
+    inline auto decimal_digits_to_chunks(ChunkBits *Dst, char const *Digits, i32 DigitCount) -> i32 {
+        i32 Count = 0;
+        for (i32 End = DigitCount ; End > 0 ; End -= DECIMAL_CHUNK_DIGITS) {
+            i32 Begin = End > DECIMAL_CHUNK_DIGITS ? End - DECIMAL_CHUNK_DIGITS : 0;
+            ChunkBits Value = 0;
+            for (i32 Idx = Begin ; Idx < End ; ++Idx) {
+                Value = Value * 10 + static_cast<ChunkBits>(Digits[Idx] - '0');
+            }
+            Dst[Count++] = Value;
+        }
+        return Count;
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Count) read as number in base 10^19, by Horner's scheme */
+    inline auto decimal_chunks_to_binary_basecase(ChunkBits *Dst, ChunkBits const *Src, i32 Count) -> void {
+        i32 Length = 0;
+        for (i32 Idx = Count-1 ; Idx >= 0 ; --Idx) {
+            ChunkBits Carry = mul_chunk(Dst, Dst, Length, DECIMAL_CHUNK_BASE);
+            if (Carry) Dst[Length++] = Carry;
+            Carry = add_chunk(Dst, Dst, Length, Src[Idx]);
+            if (Carry) Dst[Length++] = Carry;
+        }
+        zero_chunks(Dst + Length, Count - Length);
+    }
+
+    /** \return size of the scratch buffer decimal_chunks_to_binary needs, in chunks */
+    inline auto decimal_chunks_to_binary_scratch_size(i32 Count) -> i32 {
+        i32 Threshold = radix_thresholds.parse < 2 ? 2 : radix_thresholds.parse;
+        if (Count <= Threshold) return 0;
+        i32 Half = 1;
+        while (Half * 2 < Count) Half *= 2;
+        i32 Low = decimal_chunks_to_binary_scratch_size(Half);
+        i32 Combine = Count + mul_chunks_scratch_size(Count - Half, Half);
+        i32 High = decimal_chunks_to_binary_scratch_size(Count - Half);
+        i32 Own = (Count - Half) + (High > Combine ? High : Combine);
+        return Low > Own ? Low : Own;
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Count) read as number in base 10^19
+     *  \note   Dst must not overlap Src. the result always fits because 10^19 < 2^64.
+     *          Table needs decimal_power_levels(Count, radix_thresholds.parse) levels, Scratch at least decimal_chunks_to_binary_scratch_size(Count) chunks
+     */
+    inline auto decimal_chunks_to_binary(ChunkBits *Dst, ChunkBits const *Src, i32 Count, ChunkBits const *Table, ChunkScratch Scratch) -> void {
+        i32 Threshold = radix_thresholds.parse < 2 ? 2 : radix_thresholds.parse;
+        if (Count <= Threshold) {
+            decimal_chunks_to_binary_basecase(Dst, Src, Count);
+            return;
+        }
+
+        i32 Level = 0;
+        while ((2 << Level) < Count) ++Level;
+        i32 Half = 1 << Level;
+
+        decimal_chunks_to_binary(Dst, Src, Half, Table, Scratch);
+
+        ChunkBits *High = Scratch.take(Count - Half);
+        decimal_chunks_to_binary(High, Src + Half, Count - Half, Table, Scratch);
+
+        i32 Hn = significant_chunks(High, Count - Half);
+        ChunkBits const *Power = decimal_power(Table, Level);
+        i32 Pn = significant_chunks(Power, Half);
+        ChunkBits *Product = Scratch.take(Hn + Pn);
+        mul_chunks(Product, High, Hn, Power, Pn, Scratch);
+
+        zero_chunks(Dst + Half, Count - Half);
+        ChunkBits Carry = add_chunks(Dst, Dst, Product, Hn + Pn);
+        Carry = add_chunk(Dst + Hn + Pn, Dst + Hn + Pn, Count - Hn - Pn, Carry);
+        HardAssert(Carry == 0);
+    }
+
+    /** \return number of decimal chunks that can hold any Count chunks long binary number, 10^(19*1.014) > 2^64 */
+    inline auto decimal_chunks_length(i32 Count) -> i32 {
+        return Count + Count / 64 + 1;
+    }
+
+    /** \return size of the scratch buffer binary_to_decimal_chunks needs, in chunks */
+    inline auto binary_to_decimal_chunks_scratch_size(i32 Count) -> i32 {
+        i32 Threshold = radix_thresholds.print < 2 ? 2 : radix_thresholds.print;
+        if (Count <= Threshold) return 0;
+        i32 Half = 1;
+        while (Half * 2 < Count) Half *= 2;
+        i32 NewtonThreshold = div_thresholds.newton < 2 ? 2 : div_thresholds.newton;
+        i32 Div = Half >= NewtonThreshold ? div_newton_scratch_size(Count, Half) : div_knuth_scratch_size(Count, Half);
+        i32 High = binary_to_decimal_chunks_scratch_size(Count - Half);
+        i32 Own = Count + (High > Div ? High : Div);
+        i32 Low = binary_to_decimal_chunks_scratch_size(Half);
+        return Low > Own ? Low : Own;
+    }
+
+    /** \brief  Dst[0..Count) = Src[0..Sn) written in base 10^19, least significant first. Src is used up.
+     *  \note   the value has to fit into Count decimal chunks, see decimal_chunks_length.
+     *          short numbers are divided by 10^19 over and over, long ones are split by the table entry 10^(19*2^K) of half their length.
+     *          Table needs decimal_power_levels(Count, radix_thresholds.print) levels,
+     *          Scratch at least binary_to_decimal_chunks_scratch_size(Count) chunks
+     */
+    inline auto binary_to_decimal_chunks(ChunkBits *Dst, i32 Count, ChunkBits *Src, i32 Sn, ChunkBits const *Table, ChunkScratch Scratch) -> void {
+        i32 Threshold = radix_thresholds.print < 2 ? 2 : radix_thresholds.print;
+        Sn = significant_chunks(Src, Sn);
+        if (Count <= Threshold) {
+            for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+                Dst[Idx] = div_chunk(Src, Src, Sn, DECIMAL_CHUNK_BASE);
+                Sn = significant_chunks(Src, Sn);
+            }
+            HardAssert(Sn == 1 && Src[0] == 0x0);
+            return;
+        }
+
+        i32 Level = 0;
+        while ((2 << Level) < Count) ++Level;
+        i32 Half = 1 << Level;
+        ChunkBits const *Power = decimal_power(Table, Level);
+        i32 Pn = significant_chunks(Power, Half);
+
+        if (Sn < Pn) {
+            binary_to_decimal_chunks(Dst, Half, Src, Sn, Table, Scratch);
+            zero_chunks(Dst + Half, Count - Half);
+            return;
+        }
+
+        i32 Qn = Sn - Pn + 1;
+        ChunkBits *Quotient = Scratch.take(Qn);
+        div_chunks(Quotient, Src, Sn, Power, Pn, Scratch);
+        binary_to_decimal_chunks(Dst + Half, Count - Half, Quotient, Qn, Table, Scratch);
+        binary_to_decimal_chunks(Dst, Half, Src, Pn, Table, Scratch);
+    }
+
+    constexpr ChunkBits DECIMAL_DIGIT_POWERS[DECIMAL_CHUNK_DIGITS] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+        10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+        1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull
+    };
+
+    /** \return number of decimal digits in Dec[0..Count), without leading zeros, at least 1 */
+    inline auto decimal_chunks_digit_count(ChunkBits const *Dec, i32 Count) -> i32 {
+        Count = significant_chunks(Dec, Count);
+        i32 TopDigits = 1;
+        while (TopDigits < DECIMAL_CHUNK_DIGITS && Dec[Count-1] >= DECIMAL_DIGIT_POWERS[TopDigits]) ++TopDigits;
+        return (Count - 1) * DECIMAL_CHUNK_DIGITS + TopDigits;
+    }
+
+    /** \return the decimal digit at position Pos of Dec, position 0 being the least significant digit */
+    inline auto decimal_chunks_digit(ChunkBits const *Dec, i32 Pos) -> char {
+        ChunkBits Chunk = Dec[Pos / DECIMAL_CHUNK_DIGITS] / DECIMAL_DIGIT_POWERS[Pos % DECIMAL_CHUNK_DIGITS];
+        return static_cast<char>('0' + Chunk % 10);
+    }
+
+    enum class ExprOp { ADD, SUB, MUL, DIV };
+
+    /** \brief  how a result is cut to its precision: to nearest with ties to even, toward zero,
+     *          toward +infinity (UP), toward -infinity (DOWN) or away from zero
+     */
+    enum class RoundingMode { NEAREST_EVEN, TOWARD_ZERO, UP, DOWN, AWAY };
+
+    /** \brief  significant bits and rounding of the results of the fractional arithmetic, see BigDecimal::rounding_context()
+     *  \note   precision 0 means exact results, the default
+     */
+    struct RoundingContext {
+        i32 precision = 0;
+        RoundingMode mode = RoundingMode::NEAREST_EVEN;
+    };
+
+    //NOTE(##2026 10 18): tells BigDecimal and BigDecimalExpr operands apart from everything else, specialized below BigDecimalExpr.
+    template <typename T>
+    struct BigDecimalOperand { static constexpr bool value = false; };
+}
+
 
 /**\note  allocator needs to be given a value, everything else can be left to default initialization.
    \brief BigDecimal can be used to represent integers and floats.
@@ -35,10 +1914,13 @@ auto to_chars(BigDecimal<T_ChunkBitsAlloc>& A, T_CharAlloc& char_alloc) -> char
        \n i.e. as unsigned integer (the sign is stored in a separate bool)
        \n they ignore the exponent and may return values with trailing zeros,
        \n i.e. their results may not fulfill .is_normalized_fractional()
-       \n values are internally represented as a linked list of unsigned integer values.
-       \n the initial element of the list is stored directly in the struct, the rest is allocated dynamically.
-       \n chunks are stored in ascending order, i.e. data.value == least significant bits.
-       \n most significant bits are at ::get_chunk(length-1).value
+       \n the fractional arithmetic (add_fractional, mul_fractional, fma, ...) normalizes lazily: its results fulfill
+       \n .is_fractional(), i.e. may keep trailing zero bits in the lowest chunk. the value is the same, since the exponent
+       \n belongs to the leading 1. comparison, rounding and output handle that, normalize() makes it explicit.
+       \n values are internally represented as a contiguous array of unsigned integer values ("chunks").
+       \n small values live in a buffer inside the struct, bigger ones in a heap block from the allocator.
+       \n chunks are stored in ascending order, i.e. chunks[0] == least significant bits.
+       \n most significant bits are at chunks[length-1]
  */
 template <typename T_Alloc = std::allocator<ChunkBits>>
 struct BigDecimal {
@@ -59,50 +1941,39 @@ struct BigDecimal {
     static constexpr flags32 ZERO_EXPONENT   = 0x1 << 2;
     static constexpr flags32 ZERO_EVERYTHING = ZERO_DIGITS | ZERO_SIGN | ZERO_EXPONENT;
 
-    static BigDecimal<T_Alloc> temp_add_fractional;
-    static BigDecimal<T_Alloc> temp_sub_int_unsign;
-    static BigDecimal<T_Alloc> temp_sub_frac;
-    static BigDecimal<T_Alloc> temp_mul_int_0;
-    static BigDecimal<T_Alloc> temp_mul_int_1;
-    static BigDecimal<T_Alloc> temp_mul_int_carries;
-    static BigDecimal<T_Alloc> temp_div_int_a;
-    static BigDecimal<T_Alloc> temp_div_int_b;
-    static BigDecimal<T_Alloc> temp_div_int_0;
-    static BigDecimal<T_Alloc> temp_div_frac;
-    static BigDecimal<T_Alloc> temp_div_frac_int_part;
-    static BigDecimal<T_Alloc> temp_div_frac_frac_part;
-    static BigDecimal<T_Alloc> temp_pow_10;
-    static BigDecimal<T_Alloc> temp_one;
-    static BigDecimal<T_Alloc> temp_ten;
-    static BigDecimal<T_Alloc> temp_digit;
-    static BigDecimal<T_Alloc> temp_to_float;
-    static BigDecimal<T_Alloc> temp_parse_int;
-    static BigDecimal<T_Alloc> temp_parse_frac;
-    static BigDecimal<T_Alloc> temp_from_string;
-
-    static constexpr i32 TEMPORARIES_COUNT = 20;
-
-    static BigDecimal<T_Alloc> *s_all_temporaries_ptrs[TEMPORARIES_COUNT];
-
-    struct ChunkList;
-    using ChunkAlloc = std::allocator_traits<T_Alloc>::template rebind_alloc<ChunkList>;
+    //NOTE(##2026 10 18): the scratch temporaries live in a Workspace, one per thread. see workspace().
+    struct Workspace;
+
+    static constexpr i32 EXPR_TEMPORARIES_COUNT = 8; //NOTE(##2026 10 18): one per nesting level of right operands in an expression, see BigDecimalExpr
+    static constexpr i32 TEMPORARIES_COUNT = 25 + EXPR_TEMPORARIES_COUNT;
+
+    static auto workspace() -> Workspace&;
+    static auto rounding_context() -> BigDecimal_::RoundingContext&;
+
+    using ChunkAlloc = std::allocator_traits<T_Alloc>::template rebind_alloc<ChunkBits>;
     using Link = OneLink<BigDecimal*>;
     using LinkAlloc = std::allocator_traits<T_Alloc>::template rebind_alloc<Link>;
 
     //Assigned through initialize_context()
     static T_Alloc s_ctx_alloc;             //NOTE(ArokhSlade##2024 11 05): not currently used. because ChunkBits (unsigned integral values) are never allocated directly. what's actually allocated is list elements.
-    static ChunkAlloc s_chunk_alloc;        //NOTE(ArokhSlade##2024 11 05): for list nodes holding chunks of a BigDecimal object
+    static ChunkAlloc s_chunk_alloc;        //NOTE(ArokhSlade##2024 11 05): for the chunk arrays of BigDecimal objects
     static LinkAlloc s_link_alloc;          //NOTE(ArokhSlade##2024 11 05): for nodes in the list holding BigDecimal objects stored in the static context
 
-    static Link *s_ctx_links;
+    //NOTE(##2026 10 18): the context variables are the temporaries of the thread's workspace, listed per thread, no locking.
+    static thread_local Link *s_ctx_links;
+    static thread_local i32 s_ctx_count;
 
-    static i32 s_ctx_count;
     static bool s_is_context_initialized;
 
+    static std::atomic<i32> s_ctx_generation;   //NOTE(##2026 10 18): bumped by close_context(), threads then drop their workspace from the earlier context.
+    static thread_local std::unique_ptr<Workspace> s_thread_workspace;
+    static thread_local i32 s_thread_workspace_generation;
+
 
     ChunkAlloc m_chunk_alloc;
     bool is_alive;
     bool was_divided_by_zero = false;
+    bool m_is_context_variable = false; //NOTE(##2026 10 18): linked in s_ctx_links of the thread that created it
 
     using ChunkAllocTraits = std::allocator_traits<ChunkAlloc>;
 
@@ -111,50 +1982,54 @@ struct BigDecimal {
     bool is_negative = false;
     i32 exponent = 0;
 
-    u32 m_chunks_capacity = 1;
-    struct ChunkList {
-        ChunkBits value;
-        ChunkList *next,
-                  *prev;
-    } data = {};
-    //TODO(##2024 06 15): replace chunk list with dynamic arrays or a container template?
-
-    ChunkList *sentinel = &data;
+    //NOTE(##2026 10 18): chunks points either to m_inline_chunks or to a heap block of m_chunks_capacity chunks.
+    static constexpr i32 INLINE_CHUNKS_COUNT = 1;
+    i32 m_chunks_capacity = INLINE_CHUNKS_COUNT;
+    ChunkBits m_inline_chunks[INLINE_CHUNKS_COUNT] = {};
+    ChunkBits *chunks = m_inline_chunks;
 
     static auto initialize_context (const T_Alloc& ctx_alloc = T_Alloc()) -> void;
 
-    static void close_context(bool ignore_dangling_users=false) {
-        HardAssert(ignore_dangling_users || s_ctx_count == TEMPORARIES_COUNT); //NOTE(ArokhSlade##2024 08 28):should not be called otherwise
-
-        //TODO(ArokhSlade##2024 08 28): delete all context variables.
-        for (BigDecimal *temp_variable : s_all_temporaries_ptrs) {
-            temp_variable->release();
-        }
-
-        for( Link *next = nullptr, *link = s_ctx_links ; link ; link = next ) {
-            next = link->next;
-            link->value->release();
-        }
-
-        s_ctx_alloc.~T_Alloc();
-        s_chunk_alloc.~ChunkAlloc();
-        s_link_alloc.~LinkAlloc();
+    /**
+     *  \brief  releases the calling thread's workspace and the context allocators.
+     *  \note   workspaces of other threads belong to them: a thread drops its workspace when it exits or on its next
+     *          call of workspace() after initialize_context(). no other thread may compute while the context is closed.
+     *  \note   values created by the user are not context variables, they keep their allocator and release their chunks themselves.
+     */
+    static void close_context([[maybe_unused]] bool ignore_dangling_users=false) {
+        //NOTE(##2026 10 18): only workspace temporaries are context variables, so there are no dangling users to check for.
+        HardAssert(s_ctx_count == (s_thread_workspace ? TEMPORARIES_COUNT : 0));
+        s_thread_workspace.reset();
+        HardAssert(s_ctx_count == 0 && s_ctx_links == nullptr);
+
+        //NOTE(##2026 10 18): assigned, not destroyed: the static destructors still run at exit, and a destroyed ArenaAlloc
+        //would give up its reference a second time
+        s_ctx_alloc = T_Alloc{};
+        s_chunk_alloc = ChunkAlloc{};
+        s_link_alloc = LinkAlloc{};
 
         s_is_context_initialized = false;
+        ++s_ctx_generation;
 
         return;
     }
 
-    auto get_chunk(u32 Idx) -> ChunkList*;
+    auto get_chunk(i32 Idx) -> ChunkBits*;
 
-    auto expand_capacity() -> ChunkList*;
-    auto extend_length() -> ChunkList*;
+    auto expand_capacity(i32 MinCapacity = 0) -> ChunkBits*;
+    auto extend_length() -> ChunkBits*;
+    auto reserve_limbs(i32 Count) -> void;
+    auto reserve_bits(i32 BitCount) -> void { reserve_limbs(DivCeil(BitCount, CHUNK_WIDTH)); }
+    auto shrink_to_fit() -> void;
 
     auto normalize() -> void;
+    auto normalize_chunks() -> void;
 
-    auto copy_to(BigDecimal *Dst, flags32 Flags = COPY_EVERYTHING)-> void;
+    auto copy_to(BigDecimal *Dst, flags32 Flags = COPY_EVERYTHING) const -> void;
+    auto swap(BigDecimal& Other, flags32 Flags = COPY_EVERYTHING) -> void;
 
-    static auto from_string(char *Str, BigDecimal *Dst = nullptr) -> bool;
+    static auto from_string(char *Str, BigDecimal *Dst = nullptr, u32 FracPrecision = 128) -> bool { return from_string(Str, workspace(), Dst, FracPrecision); }
+    static auto from_string(char *Str, Workspace& ws, BigDecimal *Dst = nullptr, u32 FracPrecision = 128) -> bool;
 
     template <std::integral T_Src=u32>
     auto set(T_Src Val,  bool is_negative=false, i32 exponent=0) -> BigDecimal&;
@@ -163,12 +2038,15 @@ struct BigDecimal {
 
     auto set_float(real32 Val) -> void;
     auto set_double(f64 Val) -> void;
+    auto set_pow_10(i32 Exponent) -> BigDecimal& { return set_pow_10(Exponent, workspace()); }
+    auto set_pow_10(i32 Exponent, Workspace& ws) -> BigDecimal&;
 
     auto less_than_integer_signed(BigDecimal<T_Alloc>& B) -> bool;
     auto less_than_integer_unsigned(BigDecimal<T_Alloc>& B) ->bool;
     auto equals_integer(BigDecimal<T_Alloc> const& B) -> bool;
     auto greater_equals_integer(BigDecimal<T_Alloc>& B) -> bool;
     auto equals_fractional(BigDecimal<T_Alloc> const& B) -> bool;
+    auto compare_fractional(BigDecimal<T_Alloc> const& B) const -> std::strong_ordering;
     auto equal_bits(BigDecimal<T_Alloc> const& B) -> bool;
 
 
@@ -176,21 +2054,47 @@ struct BigDecimal {
     auto shift_right(u32 ShiftAmount) -> BigDecimal&;
 
     auto add_integer_unsigned (BigDecimal& B) -> void;
-    auto add_integer_signed (BigDecimal& B) -> void;
+    auto add_integer_signed (BigDecimal& B) -> void { add_integer_signed(B, workspace()); }
+    auto add_integer_signed (BigDecimal& B, Workspace& ws) -> void;
 
     auto sub_integer_unsigned_positive (BigDecimal& B)-> void;
-    auto sub_integer_unsigned (BigDecimal& B) -> void;
-    auto sub_integer_signed (BigDecimal& B) -> void;
-
-    auto mul_integer(BigDecimal& B) -> void;
-    auto div_integer (BigDecimal& B, u32 MinFracPrecision=32) -> void;
-
-    auto add_fractional (BigDecimal& B) -> void;
-    auto sub_fractional (BigDecimal& B) -> void;
-    auto mul_fractional(BigDecimal& B) -> void;
-    auto div_fractional (BigDecimal& B, u32 MinFracPrecision=32) -> void;
-
-    auto round_to_n_significant_bits(i32 N) -> void;
+    auto sub_integer_unsigned (BigDecimal& B) -> void { sub_integer_unsigned(B, workspace()); }
+    auto sub_integer_unsigned (BigDecimal& B, Workspace& ws) -> void;
+    auto sub_integer_signed (BigDecimal& B) -> void { sub_integer_signed(B, workspace()); }
+    auto sub_integer_signed (BigDecimal& B, Workspace& ws) -> void;
+
+    //NOTE(##2026 10 18): the overloads taking a Workspace keep their temporaries there instead of in the thread's workspace.
+    auto mul_integer(BigDecimal& B) -> void { mul_integer(B, workspace()); }
+    auto mul_integer(BigDecimal& B, Workspace& ws) -> void;
+    auto mul_integer_to(BigDecimal& B, BigDecimal& Product, Workspace& ws) -> void;
+    auto div_rem_integer_unsigned (BigDecimal& B, BigDecimal& Quotient) -> void { div_rem_integer_unsigned(B, Quotient, workspace()); }
+    auto div_rem_integer_unsigned (BigDecimal& B, BigDecimal& Quotient, Workspace& ws) -> void;
+    auto div_integer (BigDecimal& B, u32 MinFracPrecision=32) -> void { div_integer(B, workspace(), MinFracPrecision); }
+    auto div_integer (BigDecimal& B, Workspace& ws, u32 MinFracPrecision=32) -> void;
+
+    //NOTE(##2026 10 18): the fractional arithmetic rounds to the workspace's rounding context, or to the one passed in.
+    auto add_fractional (BigDecimal& B) -> void { add_fractional(B, workspace()); }
+    auto add_fractional (BigDecimal& B, Workspace& ws) -> void { add_fractional(B, ws, ws.rounding); }
+    auto add_fractional (BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding) -> void;
+    auto sub_fractional (BigDecimal& B) -> void { sub_fractional(B, workspace()); }
+    auto sub_fractional (BigDecimal& B, Workspace& ws) -> void { sub_fractional(B, ws, ws.rounding); }
+    auto sub_fractional (BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding) -> void;
+    auto mul_fractional(BigDecimal& B) -> void { mul_fractional(B, workspace()); }
+    auto mul_fractional(BigDecimal& B, Workspace& ws) -> void { mul_fractional(B, ws, ws.rounding); }
+    auto mul_fractional(BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding) -> void;
+    auto fma_fractional(BigDecimal& B, BigDecimal& C, i32 RoundToBits=0) -> void { fma_fractional(B, C, workspace(), RoundToBits); }
+    auto fma_fractional(BigDecimal& B, BigDecimal& C, Workspace& ws, i32 RoundToBits=0) -> void;
+    auto div_fractional (BigDecimal& B, u32 MinFracPrecision=32) -> void { div_fractional(B, workspace(), MinFracPrecision); }
+    auto div_fractional (BigDecimal& B, Workspace& ws, u32 MinFracPrecision=32) -> void { div_fractional(B, ws, ws.rounding, MinFracPrecision); }
+    auto div_fractional (BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding, u32 MinFracPrecision=32) -> void;
+
+    auto round_to_n_significant_bits(i32 N) -> void { round_to_n_significant_bits(N, workspace()); }
+    auto round_to_n_significant_bits(i32 N, Workspace& ws) -> void { round_to_n_significant_bits(N, BigDecimal_::RoundingMode::NEAREST_EVEN, ws); }
+    auto round_to_n_significant_bits(i32 N, BigDecimal_::RoundingMode Mode, Workspace& ws) -> void;
+    auto round_to(BigDecimal_::RoundingContext const& Rounding, Workspace& ws) -> void {
+        if (Rounding.precision > 0) round_to_n_significant_bits(Rounding.precision, Rounding.mode, ws);
+    }
+    static auto collapse_far_operand(BigDecimal& A, BigDecimal& B, i32 Precision) -> void;
 
     explicit operator std::string();
 
@@ -217,21 +2121,33 @@ struct BigDecimal {
     auto get_bit(i32 N) -> bool;
     auto count_bits() -> i32;
     auto get_least_significant_exponent() -> i32;
-    auto get_head() -> ChunkList*;
+    auto get_head() -> ChunkBits*;
     auto truncate_trailing_zero_bits() -> void;
     auto truncate_leading_zero_chunks() -> void;
     auto is_normalized_fractional() -> bool;
+    auto is_fractional() -> bool;
     auto is_normalized_integer() -> bool;
     auto UpdateLength() -> void;
 
-    static auto parse_integer(char *Src, BigDecimal *Dst = nullptr) -> bool;
-    static bool parse_fraction(char *FracStr, BigDecimal *Dst = nullptr);
+    static auto parse_integer(char *Src, BigDecimal *Dst = nullptr) -> bool { return parse_integer(Src, workspace(), Dst); }
+    static auto parse_integer(char *Src, Workspace& ws, BigDecimal *Dst = nullptr) -> bool;
+    static auto decimal_power_table(i32 Levels, Workspace& ws) -> ChunkBits const*;
+
+    static auto to_decimal_chunks(BigDecimal& N) -> i32;
+    static auto decimal_scale(i32 Pow10) -> void;
+    static auto decimal_round(i32 Pow10) -> void;
+    static auto decimal_exponent() -> i32;
+    static auto decimal_shortest(i32 Precision) -> i32;
+    static bool parse_fraction(char *FracStr, BigDecimal *Dst = nullptr, u32 Precision = 128) { return parse_fraction(FracStr, workspace(), Dst, Precision); }
+    static bool parse_fraction(char *FracStr, Workspace& ws, BigDecimal *Dst = nullptr, u32 Precision = 128);
 
     bool is_context_variable() {
-        return m_chunk_alloc == s_chunk_alloc;
+        return m_is_context_variable;
     }
 
     void add_context_link() {
+        HardAssert(!m_is_context_variable);
+        m_is_context_variable = true;
         //prepend to list
         Link *new_link = std::allocator_traits<LinkAlloc>::allocate(s_link_alloc, 1);
         new_link->next = s_ctx_links;
@@ -275,6 +2191,7 @@ struct BigDecimal {
 
     void remove_context_link() {
         HardAssert(is_context_variable());
+        m_is_context_variable = false;
 
         //find in list and remove
         Link *our_preceding_link = find_predecessor(this);
@@ -300,11 +2217,10 @@ struct BigDecimal {
 
     //TODO(ArokhSlade##2024 09 29): redundant? why not ambiguous? is it ever called?
     BigDecimal(T_Alloc& allocator)
-    : m_chunk_alloc{ChunkAlloc{allocator}}, is_negative{false},data{.value{0}},
+    : m_chunk_alloc{ChunkAlloc{allocator}}, is_negative{false}, m_inline_chunks{0},
       is_alive{true}
     {
         HardAssert(s_is_context_initialized);
-        if (is_context_variable()) add_context_link();
     }
 
 
@@ -314,7 +2230,6 @@ struct BigDecimal {
       exponent{exponent_}, is_alive{true}
     {
         HardAssert(s_is_context_initialized);
-        if (is_context_variable()) add_context_link();
         set_bits_64(Value_);
     }
 
@@ -364,7 +2279,6 @@ struct BigDecimal {
     {
         HardAssert(s_is_context_initialized);
         Other.copy_to(this, COPY_DIGITS);
-        if (is_context_variable()) add_context_link();
     }
 
 
@@ -374,47 +2288,38 @@ struct BigDecimal {
     {
         HardAssert(is_alive);
         other.copy_to(this, COPY_EVERYTHING);
-        add_context_link();
     }
     BigDecimal(const BigDecimal& other) = delete;
 
+    //NOTE(##2026 10 18): takes over other's heap block if the allocators are equal, other is left as zero.
+    BigDecimal(BigDecimal&& other)
+    : m_chunk_alloc{other.m_chunk_alloc}, is_alive{other.is_alive}, was_divided_by_zero{other.was_divided_by_zero}
+    {
+        HardAssert(is_alive);
+        swap(other);
+    }
+
     void release() {
         HardAssert(is_alive);
         is_alive = false;
 
-        //delete all chunks through allocator
-        ChunkList *chunk = sentinel;
-        ChunkList *prev;
-        i32 CountDeleted = 0;
-        i32 old_capacity = m_chunks_capacity;
-
-        HardAssert(sentinel->next == nullptr);
-        HardAssert(data.prev == nullptr);
-
-        while (chunk != &data) {
-            HardAssert(chunk);
-            prev = chunk->prev;
-//            std::allocator_traits<ChunkAlloc>::deallocate(m_chunk_alloc, chunk, sizeof(ChunkList)); //TODO(ArokhSlade##2024 11 05): BUG? shouldn't the last parameter be 1, for count, not size?
-            std::allocator_traits<ChunkAlloc>::deallocate(m_chunk_alloc, chunk, 1);
-            chunk = prev;
-            chunk->next = nullptr;
-            --m_chunks_capacity;
-            ++CountDeleted;
-        }
-
-        HardAssert(CountDeleted+1 == old_capacity);
-        HardAssert(m_chunks_capacity == 1);
-        HardAssert(data.next == nullptr);
+        //give the heap block back to the allocator
+        if (chunks != m_inline_chunks) {
+            HardAssert(m_chunks_capacity > INLINE_CHUNKS_COUNT);
+            ChunkAllocTraits::deallocate(m_chunk_alloc, chunks, m_chunks_capacity);
+            chunks = m_inline_chunks;
+        }
+        m_chunks_capacity = INLINE_CHUNKS_COUNT;
+
         this->zero(ZERO_EVERYTHING);
 
         length = 1;
-        sentinel = &data;
 
         if (is_context_variable()) {
             remove_context_link();
         }
 
-        m_chunk_alloc.~ChunkAlloc();
+        m_chunk_alloc = ChunkAlloc{}; //NOTE(##2026 10 18): the member destructor runs again in ~BigDecimal, see close_context()
 
         return;
     }
@@ -425,17 +2330,57 @@ struct BigDecimal {
         release();
     }
 
-    /* issues:
-     - shallow or deep copy?
-     - internal pointers (sentinel)
-     - other with other allocator
-     - other with other allocator type
-     - copy other's allocator or only their values with our current allocator?
-    */
+    //NOTE(##2026 10 18): deep copy of the value. the allocator stays ours, so does the context membership.
     BigDecimal& operator=(const BigDecimal& other){
+        if (this != &other) {
+            other.copy_to(this, COPY_EVERYTHING);
+            was_divided_by_zero = other.was_divided_by_zero;
+        }
+        return *this;
+    }
+
+    //NOTE(##2026 10 18): exchanges the storage if the allocators are equal, other is left as zero but may keep our old block.
+    BigDecimal& operator=(BigDecimal&& other){
+        if (this != &other) {
+            swap(other);
+            was_divided_by_zero = other.was_divided_by_zero;
+            other.zero(ZERO_EVERYTHING);
+        }
+        return *this;
+    }
+
+    friend auto swap(BigDecimal& A, BigDecimal& B) -> void {
+        A.swap(B);
+    }
+
+    //NOTE(##2026 10 18): the operators compare values, so -0 == +0 like in IEEE floats. equals_fractional() also checks the sign
+    //                    of zero, it's the exact check for results like x - x that have to come out as +0.
+    friend auto operator<=>(BigDecimal const& A, BigDecimal const& B) -> std::strong_ordering { return A.compare_fractional(B); }
+    friend auto operator==(BigDecimal const& A, BigDecimal const& B) -> bool { return A.compare_fractional(B) == 0; }
+
+    //NOTE(##2026 10 18): expressions like a*b + c are built by the operators below BigDecimalExpr and evaluated here, in place.
+    template <typename T_Expr> requires (T_Expr::IS_BIG_DECIMAL_EXPR)
+    BigDecimal(T_Expr const& Expr)
+    : BigDecimal{get_ctx_alloc(), 0u}
+    {
+        Expr.assign_to(*this, workspace());
+    }
+
+    template <typename T_Expr> requires (T_Expr::IS_BIG_DECIMAL_EXPR)
+    BigDecimal& operator=(T_Expr const& Expr){
+        Expr.assign_to(*this, workspace());
         return *this;
     }
 
+    template <typename T_Operand> requires (BigDecimal_::BigDecimalOperand<std::remove_cvref_t<T_Operand>>::value)
+    BigDecimal& operator+=(T_Operand&& B) { return *this = *this + B; }
+    template <typename T_Operand> requires (BigDecimal_::BigDecimalOperand<std::remove_cvref_t<T_Operand>>::value)
+    BigDecimal& operator-=(T_Operand&& B) { return *this = *this - B; }
+    template <typename T_Operand> requires (BigDecimal_::BigDecimalOperand<std::remove_cvref_t<T_Operand>>::value)
+    BigDecimal& operator*=(T_Operand&& B) { return *this = *this * B; }
+    template <typename T_Operand> requires (BigDecimal_::BigDecimalOperand<std::remove_cvref_t<T_Operand>>::value)
+    BigDecimal& operator/=(T_Operand&& B) { return *this = *this / B; }
+
     private:
 
     //NOTE(ArokhSlade##2024 08 28): this is more or less a work-around
@@ -445,7 +2390,7 @@ struct BigDecimal {
     //these variables get re-assigned, setting their allocator and incrementing the context variables counter
     BigDecimal(SpecialConstants must_belong_to_context, u32 value=0,
                bool is_negative_=false, i32 exponent_=0)
-    : m_chunk_alloc{}, data{.value{value}},
+    : m_chunk_alloc{}, m_inline_chunks{value},
       is_negative{is_negative_}, exponent{exponent_},
       is_alive{false} //NOTE()ArokhSlade##2024 08 29):allocator for static temporaries not known at startup
     {
@@ -454,7 +2399,7 @@ struct BigDecimal {
 
     BigDecimal(SpecialConstants must_belong_to_context, ChunkAlloc& chunk_alloc, u32 value=0,
                bool is_negative_=false, i32 exponent_=0)
-    : m_chunk_alloc{chunk_alloc}, data{.value{value}},
+    : m_chunk_alloc{chunk_alloc}, m_inline_chunks{value},
       is_negative{is_negative_}, exponent{exponent_},
       is_alive{true} //NOTE(ArokhSlade##2024 08 29): allocator for static temporaries not known at startup
     {
@@ -462,19 +2407,144 @@ struct BigDecimal {
         add_context_link();
     }
 
-    void initialize(ChunkAlloc& chunk_alloc) {
+    void initialize(const ChunkAlloc& chunk_alloc, bool BelongsToContext) {
         m_chunk_alloc = chunk_alloc;
         is_alive = true;
-        add_context_link();
+        if (BelongsToContext) add_context_link();
+    }
+
+    //NOTE(##2026 10 18): fast paths of the fractional arithmetic for operands of one or two chunks, exact, the caller rounds.
+    auto add_small_chunks(BigDecimal& B, bool NegateB) -> bool;
+    auto set_small_chunks(ChunkBits const *Src, i32 Count, bool IsNegative, i32 LeastSignificantExponent) -> void;
+};
+
+
+/**
+ *  \brief  the scratch temporaries used by the arithmetic of BigDecimal<T_Alloc>.
+ *  \note   each thread gets its own workspace from BigDecimal::workspace(), so independent computations can run on
+ *          several threads without locking. the temporaries of that workspace are the thread's context variables:
+ *          they count towards its s_ctx_count until the workspace goes away, i.e. until the thread exits or calls close_context().
+ *  \note   chunk memory comes from the context allocator, which must be thread-safe if more than one thread computes.
+ *  \note   a workspace built with an allocator of its own can be passed to the overloads taking a Workspace&,
+ *          its temporaries are not context variables. with an ArenaAlloc or PoolAlloc it can be emptied at once by reset().
+ */
+template <typename T_Alloc>
+struct BigDecimal<T_Alloc>::Workspace {
+    BigDecimal_::RoundingContext rounding; //NOTE(##2026 10 18): honored by the fractional arithmetic run with this workspace, see rounding_context()
+
+    BigDecimal temp_add_fractional {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_sub_int_unsign {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_sub_frac {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_mul_int_0 {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_mul_int_scratch {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_div_int_a {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_div_int_b {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_div_int_0 {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_div_frac {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_div_frac_int_part {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_div_frac_frac_part {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_pow_10 {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_pow_10_table {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_one {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_ten {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_digit {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_parse_int {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_parse_frac {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_from_string {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_dec_value {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_dec_num {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_dec_den {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_dec_int {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_dec_aux {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_dec_digits {SpecialConstants::BELONGS_TO_CONTEXT};
+    BigDecimal temp_expr[EXPR_TEMPORARIES_COUNT] {
+        {SpecialConstants::BELONGS_TO_CONTEXT}, {SpecialConstants::BELONGS_TO_CONTEXT},
+        {SpecialConstants::BELONGS_TO_CONTEXT}, {SpecialConstants::BELONGS_TO_CONTEXT},
+        {SpecialConstants::BELONGS_TO_CONTEXT}, {SpecialConstants::BELONGS_TO_CONTEXT},
+        {SpecialConstants::BELONGS_TO_CONTEXT}, {SpecialConstants::BELONGS_TO_CONTEXT}
+    };
+
+    BigDecimal *all_temporaries[TEMPORARIES_COUNT] = {
+        &temp_add_fractional, &temp_sub_int_unsign, &temp_sub_frac, &temp_mul_int_0, &temp_mul_int_scratch,
+        &temp_div_int_a, &temp_div_int_b, &temp_div_int_0, &temp_div_frac,
+        &temp_div_frac_int_part, &temp_div_frac_frac_part, &temp_pow_10, &temp_pow_10_table, &temp_one, &temp_ten,
+        &temp_digit, &temp_parse_int, &temp_parse_frac, &temp_from_string,
+        &temp_dec_value, &temp_dec_num, &temp_dec_den, &temp_dec_int, &temp_dec_aux, &temp_dec_digits,
+        &temp_expr[0], &temp_expr[1], &temp_expr[2], &temp_expr[3], &temp_expr[4], &temp_expr[5], &temp_expr[6], &temp_expr[7]
+    };
+
+    explicit Workspace(const ChunkAlloc& chunk_alloc, bool BelongsToContext = false) {
+        for (BigDecimal *temp_variable : all_temporaries) {
+            temp_variable->initialize(chunk_alloc, BelongsToContext);
+        }
+        set_constants();
+    }
+
+    /**
+     *  \brief  empties all temporaries and gives the whole arena back at once by ArenaAllocMeta::reset().
+     *  \note   the arena must belong to this workspace alone: whatever else was allocated from it is gone as well.
+     */
+    auto reset() -> void requires std::derived_from<ChunkAlloc, ArenaAlloc<ChunkBits>> {
+        ChunkAlloc& chunk_alloc = temp_one.m_chunk_alloc;
+        HardAssert(chunk_alloc.meta);
+        HardAssert(!(chunk_alloc == s_chunk_alloc));
+
+        //NOTE(##2026 10 18): the heap blocks are not deallocated one by one, resetting the arena takes them all.
+        for (BigDecimal *temp_variable : all_temporaries) {
+            temp_variable->chunks = temp_variable->m_inline_chunks;
+            temp_variable->m_chunks_capacity = INLINE_CHUNKS_COUNT;
+            temp_variable->zero(ZERO_EVERYTHING);
+        }
+        set_constants();
+
+        chunk_alloc.meta->reset(); //NOTE(##2026 10 18): also drops the free lists of a PoolAlloc, their blocks are gone
+    }
+
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+
+    private:
+
+    auto set_constants() -> void {
+        temp_one.set(1);
+        temp_ten.set(10);
+        temp_pow_10.set(1);
+        temp_parse_frac.set(1);
     }
 };
 
+/**
+ *  \brief  the calling thread's workspace, created on first use after initialize_context().
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::workspace() -> Workspace& {
+    HardAssert(s_is_context_initialized);
+    i32 Generation = s_ctx_generation.load(std::memory_order_acquire);
+    if (!s_thread_workspace || s_thread_workspace_generation != Generation) {
+        s_thread_workspace.reset();
+        s_thread_workspace = std::make_unique<Workspace>(s_chunk_alloc, true);
+        s_thread_workspace_generation = Generation;
+    }
+    return *s_thread_workspace;
+}
+
+/**
+ *  \brief  precision and rounding mode of the fractional arithmetic on the calling thread, e.g.
+ *          rounding_context() = {113, RoundingMode::TOWARD_ZERO}. exact results by default.
+ *  \note   add_fractional, sub_fractional, mul_fractional, div_fractional, fma and the expression operators round their
+ *          results to it, once, and stop computing where further bits can't change the rounded result.
+ *  \note   belongs to the thread's workspace. a Workspace passed explicitly brings its own, Workspace::rounding.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::rounding_context() -> BigDecimal_::RoundingContext& {
+    return workspace().rounding;
+}
 
 template <typename T_Alloc>
 auto Str(BigDecimal<T_Alloc>& A, memory_arena *TempArena) -> char* {
 
     char Sign = A.is_negative ? '-' : '+';
-    typename BigDecimal<T_Alloc>::ChunkList *CurChunk = A.get_head();
+    ChunkBits *CurChunk = A.get_head();
     i32 UnusedChunks = A.m_chunks_capacity - A.length;
     char HexDigits[11] = "";
 
@@ -487,8 +2557,8 @@ auto Str(BigDecimal<T_Alloc>& A, memory_arena *TempArena) -> char* {
     char *BufPos=Buf;
     *BufPos++ = Sign;
 
-    for (i32 Idx = 0 ; Idx < A.length; ++Idx, CurChunk = CurChunk->prev) {
-        stbsp_sprintf(BufPos, "%.8x ", CurChunk->value);
+    for (i32 Idx = 0 ; Idx < A.length; ++Idx, --CurChunk) {
+        stbsp_sprintf(BufPos, "%.8x ", *CurChunk);
         BufPos +=9;
     }
 
@@ -503,37 +2573,41 @@ auto Str(BigDecimal<T_Alloc>& A, memory_arena *TempArena) -> char* {
 
 
 
+/**
+ *  \brief  parses a run of decimal digits as unsigned integer into Dst (the workspace's temp_parse_int if Dst is null).
+ *  \note   19 digits are combined per chunk, the chunks are then converted by Horner's scheme or,
+ *          for long inputs, by divide and conquer, see BigDecimal_::radix_thresholds.
+ */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::parse_integer(char *Src, BigDecimal *Dst) -> bool {
+auto BigDecimal<T_Alloc>::parse_integer(char *Src, Workspace& ws, BigDecimal *Dst) -> bool {
 
-    if (!Dst) Dst = &BigDecimal<T_Alloc>::temp_parse_int;
+    if (!Dst) Dst = &ws.temp_parse_int;
 
     Dst->zero(ZERO_EVERYTHING);
 
     if (Src == nullptr || !IsNum(*Src)) return false;
 
 
-    char *LastDigit = Src;
-    while (IsNum(LastDigit[1])) {
-        ++LastDigit;
+    i32 DigitCount = 1;
+    while (IsNum(Src[DigitCount])) {
+        ++DigitCount;
     }
 
-    BigDecimal<T_Alloc>& Digit_ = BigDecimal<T_Alloc>::temp_digit;
-    BigDecimal<T_Alloc>& Pow10_ = BigDecimal<T_Alloc>::temp_pow_10;
-    BigDecimal<T_Alloc>& Ten_ = BigDecimal<T_Alloc>::temp_ten;
+    i32 Count = (DigitCount + BigDecimal_::DECIMAL_CHUNK_DIGITS - 1) / BigDecimal_::DECIMAL_CHUNK_DIGITS;
+    ChunkBits const *Table = decimal_power_table(BigDecimal_::decimal_power_levels(Count, BigDecimal_::radix_thresholds.parse), ws);
 
-    Pow10_.set(1);
-    Ten_.set(10);
+    i32 ScratchLength = Count + BigDecimal_::decimal_chunks_to_binary_scratch_size(Count);
+    BigDecimal& scratch = ws.temp_mul_int_scratch;
+    scratch.reserve_limbs(ScratchLength);
+    BigDecimal_::ChunkScratch Scratch {scratch.chunks, scratch.chunks + scratch.m_chunks_capacity};
 
-    auto ToDigit = [](char c){return static_cast<int>(c-'0');};
+    ChunkBits *Decimal = Scratch.take(Count);
+    BigDecimal_::decimal_digits_to_chunks(Decimal, Src, DigitCount);
 
-    for (char *DigitP = LastDigit ; DigitP >= Src ; --DigitP) {
-        int D = ToDigit(*DigitP);
-        Digit_.set(D);
-        Digit_.mul_integer(Pow10_);
-        Dst->add_integer_signed(Digit_);
-        Pow10_.mul_integer(Ten_);
-    }
+    Dst->reserve_limbs(Count);
+    BigDecimal_::decimal_chunks_to_binary(Dst->chunks, Decimal, Count, Table, Scratch);
+    Dst->length = Count;
+    Dst->truncate_leading_zero_chunks();
 
     Dst->exponent = Dst->get_msb();
 
@@ -541,18 +2615,54 @@ auto BigDecimal<T_Alloc>::parse_integer(char *Src, BigDecimal *Dst) -> bool {
 }
 
 
+/**
+ *  \brief  returns the table of powers 10^(19*2^Level), Level < Levels, as laid out by BigDecimal_::decimal_power_table_size.
+ *  \note   the table is cached in the calling thread's temp_pow_10_table and only grows. the pointer is valid until the next call.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::decimal_power_table(i32 Levels, Workspace& ws) -> ChunkBits const* {
+    BigDecimal& Table = ws.temp_pow_10_table;
+
+    //NOTE(##2026 10 18): the length tells how many levels are cached. a fresh temporary holds a single zero chunk, i.e. none.
+    i32 CachedLevels = 0;
+    if (Table.chunks[0] == BigDecimal_::DECIMAL_CHUNK_BASE) {
+        while (BigDecimal_::decimal_power_table_size(CachedLevels + 1) <= static_cast<i32>(Table.length)) ++CachedLevels;
+    }
+
+    if (CachedLevels < Levels) {
+        i32 TableLength = BigDecimal_::decimal_power_table_size(Levels);
+        Table.reserve_limbs(TableLength);
+
+        i32 ScratchLength = BigDecimal_::decimal_power_table_scratch_size(Levels);
+        BigDecimal& scratch = ws.temp_mul_int_scratch;
+        scratch.reserve_limbs(ScratchLength);
+        BigDecimal_::ChunkScratch Scratch {scratch.chunks, scratch.chunks + scratch.m_chunks_capacity};
+
+        BigDecimal_::fill_decimal_power_table(Table.chunks, CachedLevels, Levels, Scratch);
+        Table.length = TableLength;
+    }
+
+    return Table.chunks;
+}
+
+
+/**
+ *  \brief  parses the digits after the decimal point into Dst (the workspace's temp_parse_frac if Dst is null), in fractional format.
+ *  \note   the k digits are read as one integer N, the result is N / 10^k rounded to even at Precision significant bits.
+ *          10^k is built from the cached powers of ten, see decimal_power_table.
+ */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::parse_fraction(char *FracStr, BigDecimal<T_Alloc> *Dst) -> bool{
+auto BigDecimal<T_Alloc>::parse_fraction(char *FracStr, Workspace& ws, BigDecimal<T_Alloc> *Dst, u32 Precision) -> bool{
 
     HardAssert(!!FracStr);
+    HardAssert(Precision > 0);
 
-    if (!Dst) Dst = &BigDecimal<T_Alloc>::temp_parse_frac;
+    if (!Dst) Dst = &ws.temp_parse_frac;
 
     Dst->zero(ZERO_EVERYTHING);
 
-    BigDecimal<T_Alloc>& digit = BigDecimal<T_Alloc>::temp_digit;
-    BigDecimal<T_Alloc>& pow10 = BigDecimal<T_Alloc>::temp_pow_10;
-    BigDecimal<T_Alloc>& ten = BigDecimal<T_Alloc>::temp_ten;
+    BigDecimal<T_Alloc>& Numerator = ws.temp_digit;
+    BigDecimal<T_Alloc>& Pow10 = ws.temp_pow_10;
 
     i32 StrLen = 0;
     for (char *Cur=FracStr; IsNum(*Cur) ; ++Cur) {
@@ -560,37 +2670,62 @@ auto BigDecimal<T_Alloc>::parse_fraction(char *FracStr, BigDecimal<T_Alloc> *Dst
     }
     if (StrLen == 0) return false;
 
-    pow10.set(1,0,0);
-    ten.set(10,0,Log2I(10));
-    ten.normalize();
-    digit.zero(ZERO_EVERYTHING);
+    parse_integer(FracStr, ws, &Numerator);
+    if (Numerator.is_zero()) return true;
+    Pow10.set_pow_10(StrLen, ws);
+
+    //NOTE(##2026 10 18): N < 10^k, so the quotient of N * 2^Shift and 10^k has Precision+2 or Precision+3 bits:
+    //                    enough for guard and round bit, a non-zero remainder is folded into the lowest bit as sticky bit.
+    i32 Shift = static_cast<i32>(Precision) + 2 + Pow10.count_bits() - Numerator.count_bits();
+    Numerator.shift_left(Shift);
+    Numerator.div_rem_integer_unsigned(Pow10, *Dst, ws);
+    if (!Numerator.is_zero()) {
+        Dst->chunks[0] |= 0x1;
+    }
 
-    for (int32 i = 0 ; i < StrLen ; ++i) {
-        pow10.div_fractional(ten,128);
+    Dst->exponent = Dst->count_bits() - 1 - Shift;
+    Dst->normalize();
+    Dst->round_to_n_significant_bits(static_cast<i32>(Precision), ws);
 
-        int32 Digit = static_cast<i32>(FracStr[i]-'0');
-        int32 DigitExp = Digit == 0 ? 0 : Log2I(Digit);
-        digit.set(Digit,false,DigitExp);
-        digit.normalize();
+    HardAssert(Dst->is_normalized_fractional());
 
-        digit.mul_fractional(pow10);
+    return true;
+}
 
-        Dst->add_fractional(digit);
-    }
 
-    HardAssert(Dst->is_normalized_fractional());
+/**
+ *  \brief  this = 10^Exponent as integer, built from the cached powers of ten.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::set_pow_10(i32 Exponent, Workspace& ws) -> BigDecimal& {
+    HardAssert(Exponent >= 0);
 
-    return true;
+    ChunkBits const *Table = decimal_power_table(BigDecimal_::decimal_power_chunks_levels(Exponent), ws);
+
+    i32 ScratchLength = BigDecimal_::decimal_power_chunks_scratch_size(Exponent);
+    BigDecimal& scratch = ws.temp_mul_int_scratch;
+    scratch.reserve_limbs(ScratchLength);
+    BigDecimal_::ChunkScratch Scratch {scratch.chunks, scratch.chunks + scratch.m_chunks_capacity};
+
+    i32 Length = BigDecimal_::decimal_power_length(Exponent);
+    zero(ZERO_EVERYTHING);
+    reserve_limbs(Length);
+    BigDecimal_::decimal_power_chunks(chunks, Exponent, Table, Scratch);
+    length = Length;
+    truncate_leading_zero_chunks();
+    exponent = get_msb();
+
+    return *this;
 }
 
 
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::from_string(char *DecStr, BigDecimal<T_Alloc> *Dst) -> bool {
+auto BigDecimal<T_Alloc>::from_string(char *DecStr, Workspace& ws, BigDecimal<T_Alloc> *Dst, u32 FracPrecision) -> bool {
     using BigDec = BigDecimal<T_Alloc>;
 
     if (DecStr == nullptr) return false;
 
-    if (!Dst) Dst = &BigDec::temp_from_string;
+    if (!Dst) Dst = &ws.temp_from_string;
 
     b32 Neg = 0;
     if (IsSign(DecStr[0])) {
@@ -614,14 +2749,15 @@ auto BigDecimal<T_Alloc>::from_string(char *DecStr, BigDecimal<T_Alloc> *Dst) ->
         }
     }
 
-    if (!parse_integer(DecStr, Dst)) return false;
+    if (!parse_integer(DecStr, ws, Dst)) return false;
     Dst->normalize();
 
     if (FoundPoint) {
         char *FractionStart = DecStr+PointPos+1;
-        BigDec *Frac = &temp_parse_frac;
-        if (!parse_fraction(DecStr+PointPos+1, Frac)) return false;
-        Dst->add_fractional(*Frac);
+        BigDec *Frac = &ws.temp_parse_frac;
+        if (!parse_fraction(DecStr+PointPos+1, ws, Frac, FracPrecision)) return false;
+        Dst->add_fractional(*Frac, ws, BigDecimal_::RoundingContext{}); //NOTE(##2026 10 18): FracPrecision decides, not the rounding context
+        Dst->normalize();
     }
 
     Dst->is_negative = Neg;
@@ -633,163 +2769,339 @@ auto BigDecimal<T_Alloc>::from_string(char *DecStr, BigDecimal<T_Alloc> *Dst) ->
 
 
 /**
- *  \brief  A.length == 1 && A.data.value == 0x0
- *  \n      exponent does not matter. 0^0 is still zero
-**/
+ *  \brief  writes the non-negative integer N into temp_dec_digits, in base 10^19 chunks, least significant first.
+ *  \return number of decimal digits of N, without leading zeros, at least 1
+ */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::is_zero() -> bool {
-    return length == 1 && data.value == 0x0;
-}
+auto BigDecimal<T_Alloc>::to_decimal_chunks(BigDecimal& N) -> i32 {
+    Workspace& ws = workspace();
+    HardAssert(N.is_normalized_integer());
 
-//TODO(ArokhSlade##2024 08 27): why does this not work?
-//template <typename T_Alloc>
-//using is_ctx_var = BigDecimal<T_Alloc>::BELONGS_TO_CONTEXT;
+    i32 Sn = N.length;
+    i32 Dn = BigDecimal_::decimal_chunks_length(Sn);
+    ChunkBits const *Table = decimal_power_table(BigDecimal_::decimal_power_levels(Dn, BigDecimal_::radix_thresholds.print), ws);
 
-//template <typename T_Alloc>
-//constexpr auto is_ctx_var = BigDecimal<T_Alloc>::BELONGS_TO_CONTEXT;
+    BigDecimal& Digits = ws.temp_dec_digits;
+    Digits.reserve_limbs(Dn);
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_add_fractional {BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+    i32 ScratchLength = Sn + BigDecimal_::binary_to_decimal_chunks_scratch_size(Dn);
+    BigDecimal& scratch = ws.temp_mul_int_scratch;
+    scratch.reserve_limbs(ScratchLength);
+    BigDecimal_::ChunkScratch Scratch {scratch.chunks, scratch.chunks + scratch.m_chunks_capacity};
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_sub_int_unsign {BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+    ChunkBits *Src = Scratch.take(Sn);
+    BigDecimal_::copy_chunks(Src, N.chunks, Sn);
+    BigDecimal_::binary_to_decimal_chunks(Digits.chunks, Dn, Src, Sn, Table, Scratch);
+    Digits.length = Dn;
+    Digits.truncate_leading_zero_chunks();
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_sub_frac{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+    return BigDecimal_::decimal_chunks_digit_count(Digits.chunks, Digits.length);
+}
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_mul_int_0 {BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
 
+/**
+ *  \brief  temp_dec_value * 10^Pow10 as fraction of integers: temp_dec_num / temp_dec_den.
+ *  \note   temp_dec_value must be normalized and positive. the powers of two and of ten go to the numerator or the denominator by sign.
+ */
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_mul_int_1 {BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+auto BigDecimal<T_Alloc>::decimal_scale(i32 Pow10) -> void {
+    Workspace& ws = workspace();
+    BigDecimal& Value = ws.temp_dec_value;
+    BigDecimal& Num = ws.temp_dec_num;
+    BigDecimal& Den = ws.temp_dec_den;
+
+    i32 Pow2 = Value.exponent - Value.get_msb();
+
+    Value.copy_to(&Num, COPY_DIGITS);
+    Num.is_negative = false;
+    if (Pow10 > 0) {
+        ws.temp_pow_10.set_pow_10(Pow10, ws);
+        Num.mul_integer(ws.temp_pow_10, ws);
+    }
+    if (Pow2 > 0) {
+        Num.shift_left(Pow2);
+    }
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_mul_int_carries {BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+    if (Pow10 < 0) {
+        Den.set_pow_10(-Pow10, ws);
+    } else {
+        Den.set(1);
+    }
+    if (Pow2 < 0) {
+        Den.shift_left(-Pow2);
+    }
+}
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_one {BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
 
+/**
+ *  \brief  temp_dec_int = temp_dec_value * 10^Pow10, rounded to the nearest integer, ties to even.
+ */
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_div_int_a{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+auto BigDecimal<T_Alloc>::decimal_round(i32 Pow10) -> void {
+    Workspace& ws = workspace();
+    BigDecimal& Num = ws.temp_dec_num;
+    BigDecimal& Den = ws.temp_dec_den;
+    BigDecimal& Int = ws.temp_dec_int;
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_div_int_b{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+    decimal_scale(Pow10);
+    Num.div_rem_integer_unsigned(Den, Int, ws);
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_div_int_0{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+    Num.shift_left(1);
+    bool RoundUp = Den.less_than_integer_unsigned(Num) || (Num.equal_bits(Den) && (Int.chunks[0] & 0x1));
+    if (RoundUp) {
+        Int.add_integer_unsigned(ws.temp_one);
+    }
+}
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_div_frac{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
 
+/**
+ *  \return floor(log10(temp_dec_value)), temp_dec_value must be normalized, positive and not zero.
+ */
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_div_frac_int_part{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+auto BigDecimal<T_Alloc>::decimal_exponent() -> i32 {
+    Workspace& ws = workspace();
+    BigDecimal& Int = ws.temp_dec_int;
+
+    //NOTE(##2026 10 18): log10(2) * exponent is off by at most one, the loop corrects it.
+    f64 Estimate = ws.temp_dec_value.exponent * 0.30102999566398120;
+    i32 Result = static_cast<i32>(Estimate);
+    if (Estimate < Result) --Result;
+
+    for (;;) {
+        decimal_scale(-Result);
+        ws.temp_dec_num.div_rem_integer_unsigned(ws.temp_dec_den, Int, ws);
+        if (Int.is_zero()) {
+            --Result;
+        } else if (Int.length > 1 || Int.chunks[0] >= 10) {
+            ++Result;
+        } else {
+            return Result;
+        }
+    }
+}
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_div_frac_frac_part{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
 
+/**
+ *  \brief  looks for a decimal with the fewest significant digits that rounds back to temp_dec_value at Precision bits.
+ *          the decimal goes to temp_dec_int, as integer scaled by 10^Scale.
+ *  \return Scale
+ *  \note   temp_dec_value must be normalized, positive, not zero and have at most Precision bits.
+ *          whether a decimal with a given digit count exists is checked exactly, by integers,
+ *          and the digit count is found by binary search.
+ */
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_pow_10{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+auto BigDecimal<T_Alloc>::decimal_shortest(i32 Precision) -> i32 {
+    Workspace& ws = workspace();
+    BigDecimal& Value = ws.temp_dec_value;
+    BigDecimal& Num = ws.temp_dec_num;
+    BigDecimal& Den = ws.temp_dec_den;
+    BigDecimal& Int = ws.temp_dec_int;
+    BigDecimal& Bound = ws.temp_dec_aux;
+    BigDecimal& Twice = ws.temp_pow_10;
+
+    i32 BitCount = Value.count_bits();
+    HardAssert(BitCount <= Precision);
+
+    // values within half an ulp round to Value. the ulp below a power of two is half as big.
+    // if Value fills all Precision bits its last bit is 1, then the midpoints round away from it.
+    i32 Ulp2 = Value.exponent - Precision + 1;
+    i32 Pow2 = Value.exponent - (BitCount - 1);
+    i32 DenPow2 = Pow2 < 0 ? -Pow2 : 0;
+    i32 Extra = Ulp2 + DenPow2 < 0 ? -(Ulp2 + DenPow2) : 0;
+    bool Inclusive = Precision > BitCount;
+    bool PowerOfTwo = BitCount == 1;
+    i32 Exponent10 = decimal_exponent();
+
+    auto IsInside = [&](BigDecimal& Diff, i32 Shift) -> bool {
+        Diff.shift_left(Shift);
+        return Diff.less_than_integer_unsigned(Bound) || (Inclusive && Diff.equal_bits(Bound));
+    };
+
+    // |Candidate - Value| * 10^Scale * Den < ulp/2 * 10^Scale * Den, both sides times 4 * 2^Extra to stay integral
+    auto TryDigits = [&](i32 DigitCount) -> bool {
+        i32 Scale = DigitCount - 1 - Exponent10;
+        decimal_scale(Scale);
+        Num.div_rem_integer_unsigned(Den, Int, ws);
+
+        Bound.set_pow_10(Scale > 0 ? Scale : 0, ws);
+        Bound.shift_left(Ulp2 + 1 + DenPow2 + Extra);
+
+        Num.copy_to(&Twice, COPY_DIGITS);
+        Twice.shift_left(1);
+        i32 Nearer = Twice.less_than_integer_unsigned(Den) ? -1 : Twice.equal_bits(Den) ? 0 : 1;
+
+        Den.sub_integer_unsigned_positive(Num);
+        bool AboveOk = IsInside(Den, 2 + Extra);
+        bool BelowOk = IsInside(Num, 2 + Extra + (PowerOfTwo ? 1 : 0));
+
+        bool RoundUp = AboveOk && (!BelowOk || Nearer > 0 || (Nearer == 0 && (Int.chunks[0] & 0x1)));
+        if (RoundUp) {
+            Int.add_integer_unsigned(ws.temp_one);
+        }
+        return AboveOk || BelowOk;
+    };
+
+    i32 Low = 1;
+    i32 High = static_cast<i32>(Precision * 0.30102999566398120) + 2;
+    while (Low < High) {
+        i32 Mid = Low + (High - Low) / 2;
+        if (TryDigits(Mid)) High = Mid;
+        else Low = Mid + 1;
+    }
+    bool Found = TryDigits(Low);
+    HardAssert(Found);
+
+    return Low - 1 - Exponent10;
+}
 
-template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_ten{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
 
+/**
+ *  \brief  A.length == 1 && A.chunks[0] == 0x0
+ *  \n      exponent does not matter. 0^0 is still zero
+**/
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_digit{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+auto BigDecimal<T_Alloc>::is_zero() -> bool {
+    return length == 1 && chunks[0] == 0x0;
+}
+
+//TODO(ArokhSlade##2024 08 27): why does this not work?
+//template <typename T_Alloc>
+//using is_ctx_var = BigDecimal<T_Alloc>::BELONGS_TO_CONTEXT;
+
+//template <typename T_Alloc>
+//constexpr auto is_ctx_var = BigDecimal<T_Alloc>::BELONGS_TO_CONTEXT;
 
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_to_float{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+bool BigDecimal<T_Alloc>::s_is_context_initialized {false};
 
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_parse_int{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+thread_local i32 BigDecimal<T_Alloc>::s_ctx_count{0};
 
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_parse_frac{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+T_Alloc BigDecimal<T_Alloc>::s_ctx_alloc{};
 
 template <typename T_Alloc>
-BigDecimal<T_Alloc> BigDecimal<T_Alloc>::temp_from_string{BigDecimal<T_Alloc>::SpecialConstants::BELONGS_TO_CONTEXT};
+BigDecimal<T_Alloc>::ChunkAlloc BigDecimal<T_Alloc>::s_chunk_alloc{};
 
 template <typename T_Alloc>
-BigDecimal<T_Alloc> *BigDecimal<T_Alloc>::s_all_temporaries_ptrs[TEMPORARIES_COUNT] = {
-        &temp_add_fractional, &temp_sub_int_unsign, &temp_sub_frac, &temp_mul_int_0, &temp_mul_int_1,
-        &temp_mul_int_carries, &temp_div_int_a, &temp_div_int_b, &temp_div_int_0, &temp_div_frac,
-        &temp_div_frac_int_part, &temp_div_frac_frac_part, &temp_pow_10, &temp_one, &temp_ten,
-        &temp_digit, &temp_to_float, &temp_parse_int, &temp_parse_frac, &temp_from_string
-    };
+BigDecimal<T_Alloc>::LinkAlloc BigDecimal<T_Alloc>::s_link_alloc{BigDecimal<T_Alloc>::s_chunk_alloc};
 
+template <typename T_Alloc>
+thread_local BigDecimal<T_Alloc>::Link *BigDecimal<T_Alloc>::s_ctx_links = nullptr;
 
 template <typename T_Alloc>
-bool BigDecimal<T_Alloc>::s_is_context_initialized {false};
+std::atomic<i32> BigDecimal<T_Alloc>::s_ctx_generation{0};
 
 template <typename T_Alloc>
-i32 BigDecimal<T_Alloc>::s_ctx_count{0};
+thread_local std::unique_ptr<typename BigDecimal<T_Alloc>::Workspace> BigDecimal<T_Alloc>::s_thread_workspace{};
 
 template <typename T_Alloc>
-T_Alloc BigDecimal<T_Alloc>::s_ctx_alloc{};
+thread_local i32 BigDecimal<T_Alloc>::s_thread_workspace_generation{0};
+
+
 
+
+/**
+ * \note will return nullptr if given index exceeds capacity
+ * \note may return a chunk beyond `length`, i.e. that's currently not in use,
+ * i.e. that currently doesn't contain a part of the number's current value
+ */
 template <typename T_Alloc>
-BigDecimal<T_Alloc>::ChunkAlloc BigDecimal<T_Alloc>::s_chunk_alloc{};
+auto BigDecimal<T_Alloc>::get_chunk(i32 Idx) -> ChunkBits * {
+    ChunkBits *Result = nullptr;
+    if (0 <= Idx && Idx < m_chunks_capacity) {
+        Result = chunks + Idx;
+    }
+    return Result;
+}
 
 template <typename T_Alloc>
-BigDecimal<T_Alloc>::LinkAlloc BigDecimal<T_Alloc>::s_link_alloc{BigDecimal<T_Alloc>::s_chunk_alloc};
+auto BigDecimal<T_Alloc>::get_head() -> ChunkBits* {
+    return get_chunk(length-1);
+}
 
+/**
+ * \brief  moves the chunks into a bigger heap block: at least twice the old capacity, at least MinCapacity.
+ *         all old chunks (up to capacity, not just up to length) are carried over, new chunks are zero.
+ * \return pointer to the first new chunk (index == old capacity)
+ * \note   invalidates all pointers into the old chunks
+ */
 template <typename T_Alloc>
-BigDecimal<T_Alloc>::Link *BigDecimal<T_Alloc>::s_ctx_links = nullptr;
+auto BigDecimal<T_Alloc>::expand_capacity(i32 MinCapacity) -> ChunkBits* {
+    i32 OldCapacity = m_chunks_capacity;
+    i32 NewCapacity = OldCapacity * 2 > MinCapacity ? OldCapacity * 2 : MinCapacity;
 
+    ChunkBits *NewChunks = ChunkAllocTraits::allocate(m_chunk_alloc, NewCapacity);
+    HardAssert(NewChunks != nullptr);
+    BigDecimal_::copy_chunks(NewChunks, chunks, OldCapacity);
+    BigDecimal_::zero_chunks(NewChunks + OldCapacity, NewCapacity - OldCapacity);
 
+    if (chunks != m_inline_chunks) {
+        ChunkAllocTraits::deallocate(m_chunk_alloc, chunks, OldCapacity);
+    }
+    chunks = NewChunks;
+    m_chunks_capacity = NewCapacity;
 
+    return chunks + OldCapacity;
+}
 
 /**
- * \note will return nullptr if given index exceeds capacity
- * \note may return a chunk beyond `length`, i.e. that's currently not in use,
- * i.e. that currently doesn't contain a part of the number's current value
+ * \brief  makes room for Count chunks in one step, for kernels that know the size of their result up front.
+ * \note   length is unchanged, the chunks above it are zero. invalidates all pointers into the old chunks if it allocates.
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::get_chunk(u32 Idx) -> ChunkList * {
-    ChunkList *Result = nullptr;
-    if (Idx < m_chunks_capacity) {
-        Result = &data;
-        while (Idx-- > 0) {
-            Result = Result ->next;
-        }
+auto BigDecimal<T_Alloc>::reserve_limbs(i32 Count) -> void {
+    if (Count > m_chunks_capacity) {
+        expand_capacity(Count);
     }
-    return Result;
-}
-
-template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::get_head() -> ChunkList* {
-    return get_chunk(length-1);
 }
 
 /**
- * \brief Allocates another chunk
+ * \brief  gives the capacity above length back: to the inline chunks if the value fits there, otherwise to a block of exactly length chunks.
+ * \note   invalidates all pointers into the old chunks
+ * \note   with an ArenaAlloc a new block would sit above the old one, which the arena can then no longer take back (LIFO).
+ *         so the block stays and only its unused top goes back, which works if the block is the arena's latest allocation.
+ *         otherwise the capacity is left as it is. the inline chunks are still used if the value fits there.
  */
 template <typename T_Alloc>
-//TODO(## 2023 11 23): support List nodes that are multiple chunks long?
-auto BigDecimal<T_Alloc>::expand_capacity() -> ChunkList* {
-    ChunkList *NewChunk = (ChunkList*)ChunkAllocTraits::allocate(m_chunk_alloc, 1);
-    HardAssert(NewChunk != nullptr);
-    *NewChunk = {.value = 0, .next = nullptr, .prev = nullptr};
-    sentinel->next = NewChunk;
-    NewChunk->prev = sentinel;
-    sentinel = NewChunk;
-    ++m_chunks_capacity;
+auto BigDecimal<T_Alloc>::shrink_to_fit() -> void {
+    if (chunks == m_inline_chunks || length == m_chunks_capacity) return;
+
+    i32 NewCapacity = length > INLINE_CHUNKS_COUNT ? length : INLINE_CHUNKS_COUNT;
+    if constexpr (std::same_as<ChunkAlloc, ArenaAlloc<ChunkBits>>) {
+        if (NewCapacity > INLINE_CHUNKS_COUNT) {
+            if (m_chunk_alloc.meta->free_last(chunks + NewCapacity, (m_chunks_capacity - NewCapacity) * sizeof(ChunkBits))) {
+                m_chunks_capacity = NewCapacity;
+            }
+            return;
+        }
+    }
+    ChunkBits *NewChunks = m_inline_chunks;
+    if (NewCapacity > INLINE_CHUNKS_COUNT) {
+        NewChunks = ChunkAllocTraits::allocate(m_chunk_alloc, NewCapacity);
+        HardAssert(NewChunks != nullptr);
+    }
+    BigDecimal_::copy_chunks(NewChunks, chunks, length);
+    BigDecimal_::zero_chunks(NewChunks + length, NewCapacity - length);
 
-    return NewChunk;
+    ChunkAllocTraits::deallocate(m_chunk_alloc, chunks, m_chunks_capacity);
+    chunks = NewChunks;
+    m_chunks_capacity = NewCapacity;
 }
 
 /**
- * \brief increase length, allocate when appropriate, return pointer to last chunk (index == length-1) in list.
+ * \brief increase length, allocate when appropriate, return pointer to last chunk (index == length-1).
  *     \n NOTE: Sets the new chunk's value to Zero.
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::extend_length() -> ChunkList* {
+auto BigDecimal<T_Alloc>::extend_length() -> ChunkBits* {
     HardAssert(length <= m_chunks_capacity);
-    ++length;
-    ChunkList *Result = get_head();
-    if (Result == nullptr) {
-        Result = expand_capacity();
+    if (length == m_chunks_capacity) {
+        expand_capacity();
     }
-    Result->value = 0;
+    ++length;
+    ChunkBits *Result = get_head();
+    *Result = 0;
 
     return Result;
 }
@@ -808,32 +3120,19 @@ auto BigDecimal<T_Alloc>::add_integer_unsigned (BigDecimal& B) -> void {
     A.UpdateLength();
     B.UpdateLength();
 
-
-    u32 LongerLength =  A.length >= B.length ? A.length : B.length;
-    u32 ShorterLength =  A.length <= B.length ? A.length : B.length;
-    ChunkList *ChunkA = &A.data, *ChunkB = &B.data;
-
-    ChunkBits OldCarry = 0;
-    //TODO(##2023 11 23): if (A.length < B.length) {/*allocate and append B.length-A.length chunks}
-    for ( u32 Idx = 0
-        ; Idx < LongerLength
-        ; ++Idx,
-          ChunkA = ChunkA ? ChunkA->next : nullptr,
-          ChunkB = ChunkB ? ChunkB->next : nullptr ) {
-
-        if ( Idx >= A.length)  {
-            ChunkA = A.extend_length();
-        }
-
-        ChunkBits ChunkBValue = Idx < B.length ? ChunkB->value : 0U;
-        bool NewCarry = MAX_CHUNK_VAL - ChunkBValue - OldCarry < ChunkA->value;
-        ChunkA->value += ChunkBValue + OldCarry; //wrap-around is fine
-        OldCarry = NewCarry;
+    i32 LengthB = B.length; //NOTE(##2026 10 18): B may be A
+    A.reserve_limbs(LengthB); //NOTE(##2026 10 18): a carry out of the top chunk still extends by one, it's rare
+    if (A.length < LengthB) {
+        BigDecimal_::zero_chunks(A.chunks + A.length, LengthB - A.length);
+        A.length = LengthB;
     }
 
-    if (OldCarry) {
-        ChunkA = extend_length();
-        ChunkA->value = OldCarry;
+    ChunkBits Carry = BigDecimal_::add_chunks(A.chunks, A.chunks, B.chunks, LengthB);
+    Carry = BigDecimal_::add_chunk(A.chunks + LengthB, A.chunks + LengthB, A.length - LengthB, Carry);
+
+    if (Carry) {
+        ChunkBits *Head = extend_length();
+        *Head = Carry;
     }
 
     return;
@@ -843,7 +3142,7 @@ auto BigDecimal<T_Alloc>::add_integer_unsigned (BigDecimal& B) -> void {
 
 template <typename T_Alloc>
 //TODO(## 2023 11 18) : test case where allocator returns nullptr
-auto BigDecimal<T_Alloc>::add_integer_signed (BigDecimal& B) -> void {
+auto BigDecimal<T_Alloc>::add_integer_signed (BigDecimal& B, Workspace& ws) -> void {
 
     HardAssert(this->is_normalized_integer());
 
@@ -852,11 +3151,11 @@ auto BigDecimal<T_Alloc>::add_integer_signed (BigDecimal& B) -> void {
         add_integer_unsigned(B);
     } else if (A.is_negative) {
         A.neg();
-        A.sub_integer_signed(B);
+        A.sub_integer_signed(B, ws);
         A.neg();
     } else { /* (B.is_negative) */
         B.neg();
-        A.sub_integer_signed(B);
+        A.sub_integer_signed(B, ws);
         B.neg();
     }
 
@@ -871,9 +3170,8 @@ auto BigDecimal<T_Alloc>::truncate_trailing_zero_bits() -> void {
     i32 TruncCount = 0;
     i32 FirstOne = 0;
     bool BitFound = false;
-    ChunkList *Current = &this->data;
-    for (i32 Block = 0 ; Block < length; ++Block, Current = Current -> next) {
-        FirstOne = BitScan<ChunkBits>(Current->value);
+    for (i32 Block = 0 ; Block < length; ++Block) {
+        FirstOne = chunks[Block] != 0x0 ? static_cast<i32>(BigDecimal_::trailing_zeros(chunks[Block])) : BIT_SCAN_NO_HIT;
         if (FirstOne != BIT_SCAN_NO_HIT) {
             TruncCount += FirstOne;
             BitFound = true;
@@ -888,11 +3186,7 @@ auto BigDecimal<T_Alloc>::truncate_trailing_zero_bits() -> void {
 
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::truncate_leading_zero_chunks() -> void {
-    for (ChunkList *Cur{ get_head() } ; Cur != &data ; Cur = Cur->prev )
-    {
-        if (Cur->value == 0x0) --length;
-        else break;
-    };
+    length = BigDecimal_::significant_chunks(chunks, length);
     HardAssert (length >= 1);
 }
 
@@ -905,19 +3199,42 @@ auto BigDecimal<T_Alloc>::normalize() -> void {
     truncate_trailing_zero_bits();
 }
 
+/** \brief  the lazy normalize() that ends the fractional arithmetic: gets rid of leading zero chunks and trailing zero chunks,
+ *          but leaves the trailing zero bits of the lowest chunk, so there is no bit shift. exponent doesn't change.
+ *  \note   afterwards this->is_fractional(). trailing zeros can't pile up across operations, there are fewer than CHUNK_WIDTH.
+ **/
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::normalize_chunks() -> void {
+    truncate_leading_zero_chunks();
+    if (chunks[0] != 0x0 || is_zero()) return;
+    i32 ZeroChunks = 1;
+    while (chunks[ZeroChunks] == 0x0) ++ZeroChunks;
+    BigDecimal_::shift_right_chunks(chunks, chunks + ZeroChunks, length - ZeroChunks, 0);
+    length -= ZeroChunks;
+}
+
 
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::is_normalized_fractional() -> bool {
     if (this->is_zero()) return true;
-    bool has_trailing_zeros = (data.value&0x1) == 0;
-    bool has_leading_zero_chunks = get_head()->value == 0x0;
+    bool has_trailing_zeros = (chunks[0]&0x1) == 0;
+    bool has_leading_zero_chunks = *get_head() == 0x0;
     if ( has_trailing_zeros || has_leading_zero_chunks) return false;
     return true;
 }
 
+/** \brief  fractional format as left by the fractional arithmetic: like is_normalized_fractional(), but the lowest chunk may
+ *          have trailing zero bits, see normalize_chunks().
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::is_fractional() -> bool {
+    if (this->is_zero()) return true;
+    return chunks[0] != 0x0 && *get_head() != 0x0;
+}
+
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::is_normalized_integer() -> bool {
-    return this->is_zero() || get_head()->value != 0x0;
+    return this->is_zero() || *get_head() != 0x0;
 }
 
 
@@ -928,43 +3245,58 @@ auto BigDecimal<T_Alloc>::is_normalized_integer() -> bool {
 **/
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::UpdateLength() -> void {
-    ChunkList *chunk = &data;
-    i32 chunks_visited = 1;
-    i32 new_length = 1;
-    while (chunks_visited < length && (chunk = chunk->next)) {
-        ++chunks_visited;
-
-        if (chunk->value != 0x0) {
-            new_length = chunks_visited;
-        }
-    }
-    this->length = new_length;
+    this->length = BigDecimal_::significant_chunks(chunks, length);
     return;
 }
 
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::copy_to(BigDecimal *Dst, flags32 Flags) -> void {
+auto BigDecimal<T_Alloc>::copy_to(BigDecimal *Dst, flags32 Flags) const -> void {
     HardAssert(Dst != nullptr);
 
     if (IsSet(Flags, COPY_SIGN)) Dst->is_negative = this->is_negative;
     if (IsSet(Flags, COPY_EXPONENT)) Dst->exponent = this->exponent;
 
 
-    if (IsSet(Flags, COPY_DIGITS)) {
-
-        ChunkList *Ours = &data, *Theirs = &Dst->data;
+    if (IsSet(Flags, COPY_DIGITS) && Dst != this) {
 
-        while (Dst->length < length) Dst->extend_length();
+        Dst->reserve_limbs(length);
 
         Dst->length = length; //if Dst->length > this->length
 
-        for ( u32 Idx = 0 ; Idx < length ; ++Idx ) {
+        BigDecimal_::copy_chunks(Dst->chunks, chunks, length);
+    }
+
+    return;
+}
+
+/**
+ *  \brief  exchanges the parts selected by Flags (see copy_to) with Other.
+ *  \note   with equal allocators the digits change hands by pointer, heap blocks included. otherwise they are swapped chunk by chunk.
+ *  \note   each side keeps its allocator and its context membership.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::swap(BigDecimal& Other, flags32 Flags) -> void {
+    if (&Other == this) return;
 
-            Theirs->value = Ours->value;
+    if (IsSet(Flags, COPY_SIGN)) std::swap(is_negative, Other.is_negative);
+    if (IsSet(Flags, COPY_EXPONENT)) std::swap(exponent, Other.exponent);
 
-            Ours = Ours->next;
-            Theirs = Theirs->next;
+    if (IsSet(Flags, COPY_DIGITS)) {
+        if (m_chunk_alloc == Other.m_chunk_alloc) {
+            bool WasInline = chunks == m_inline_chunks;
+            bool OtherWasInline = Other.chunks == Other.m_inline_chunks;
+            std::swap(m_inline_chunks, Other.m_inline_chunks);
+            std::swap(chunks, Other.chunks);
+            std::swap(m_chunks_capacity, Other.m_chunks_capacity);
+            if (OtherWasInline) chunks = m_inline_chunks;
+            if (WasInline) Other.chunks = Other.m_inline_chunks;
+        } else {
+            i32 Length = length > Other.length ? length : Other.length;
+            reserve_limbs(Length);
+            Other.reserve_limbs(Length);
+            std::swap_ranges(chunks, chunks + Length, Other.chunks);
         }
+        std::swap(length, Other.length);
     }
 
     return;
@@ -980,19 +3312,8 @@ auto BigDecimal<T_Alloc>::less_than_integer_unsigned(BigDecimal<T_Alloc>& B) ->b
 
     BigDecimal<T_Alloc>& A = *this;
     bool Result = false;
-    u32 length = A.length;
     if (A.length == B.length) {
-        for ( typename BigDecimal<T_Alloc>::ChunkList
-                *A_chunk = A.get_head(),
-                *B_chunk = B.get_head()
-            ; length > 0
-            ; A_chunk = A_chunk->prev, B_chunk = B_chunk->prev, --length) {
-            if (A_chunk->value == B_chunk->value) {
-                continue;
-            }
-            Result = A_chunk->value < B_chunk->value;
-            break;
-        }
+        Result = BigDecimal_::compare_chunks(A.chunks, B.chunks, A.length) < 0;
     } else {
         Result = A.length < B.length;
     }
@@ -1021,17 +3342,7 @@ auto BigDecimal<T_Alloc>::equal_bits(BigDecimal<T_Alloc> const& B) -> bool {
     BigDecimal<T_Alloc>& A = *this;
     bool all_equal = true;
     all_equal &= A.length == B.length;
-
-    using p_chunk = typename BigDecimal<T_Alloc>::ChunkList const *;
-    p_chunk chunk_A = &A.data, chunk_B = &B.data;
-
-    for ( u32 idx = 0 ; idx < A.length && all_equal ; ++idx ) {
-
-        all_equal &= chunk_A->value == chunk_B->value;
-
-        chunk_A = chunk_A->next;
-        chunk_B = chunk_B->next;
-    }
+    all_equal = all_equal && BigDecimal_::compare_chunks(A.chunks, B.chunks, A.length) == 0;
 
     return all_equal;
 }
@@ -1047,23 +3358,58 @@ auto BigDecimal<T_Alloc>::equals_integer(BigDecimal<T_Alloc> const& B) -> bool {
     return all_equal;
 }
 
+/**
+\brief  same sign, exponent and chunks, trailing zero bits aside. unlike operator== this tells -0 and +0 apart.
+ */
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::equals_fractional(BigDecimal<T_Alloc> const& B) -> bool {
 
     BigDecimal<T_Alloc>& A = *this;
     bool all_equal = true;
-    all_equal &= A.equals_integer(B);
+    all_equal &= A.is_negative == B.is_negative;
     all_equal &= A.exponent == B.exponent;
+    //NOTE(##2026 10 18): trailing zero bits don't change a fractional, see normalize_chunks()
+    all_equal = all_equal && BigDecimal_::equal_chunks_but_trailing_zeros(A.chunks, A.length, B.chunks, B.length);
 
     return all_equal;
 }
 
 
-//TODO(##2024 06 08) param Allocator not used
+/**
+\brief  orders two fractionals by value: sign first, then exponent, then the chunks from the top down, stopping at the
+        first one that differs. -0 and +0 are equal, trailing zero bits (see normalize_chunks()) don't matter.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::compare_fractional(BigDecimal<T_Alloc> const& B) const -> std::strong_ordering {
+    BigDecimal<T_Alloc> const& A = *this;
+    bool ZeroA = A.length == 1 && A.chunks[0] == 0x0;
+    bool ZeroB = B.length == 1 && B.chunks[0] == 0x0;
+    if (ZeroA || ZeroB) {
+        if (ZeroA && ZeroB) return std::strong_ordering::equal;
+        bool NegativeSide = ZeroA ? !B.is_negative : A.is_negative;
+        return NegativeSide ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    if (A.is_negative != B.is_negative) {
+        return A.is_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+
+    i32 Magnitude = A.exponent != B.exponent ? (A.exponent < B.exponent ? -1 : 1)
+                  : BigDecimal_::compare_chunks_from_top(A.chunks, A.length, B.chunks, B.length);
+    if (A.is_negative) Magnitude = -Magnitude;
+    return Magnitude <=> 0;
+}
+
+template <typename T_Alloc>
+auto compare(BigDecimal<T_Alloc> const& A, BigDecimal<T_Alloc> const& B) -> std::strong_ordering {
+    return A.compare_fractional(B);
+}
+
+
+//NOTE(##2026 10 18): less_than_integer_signed is a strict total order, so its negation is >=, in a single scan
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::greater_equals_integer(BigDecimal<T_Alloc>& B) -> bool {
     BigDecimal<T_Alloc>& A = *this;
-    return B.less_than_integer_signed( A ) || A.equals_integer( B );
+    return !A.less_than_integer_signed( B );
 }
 
 /**
@@ -1081,46 +3427,13 @@ auto BigDecimal<T_Alloc>::sub_integer_unsigned_positive (BigDecimal& B)-> void {
 
     HardAssert(A.greater_equals_integer(B));
 
-    ChunkList *ChunkA = &A.data;
-    ChunkList *ChunkB = &B.data;
-    u32 LeadingZeroBlocks = 0;
-    u32 iterations = [](BigDecimal<T_Alloc>& X){
-        ChunkList *cur = &X.data;
-        i32 chunks_visited = 1;
-        i32 significant_chunks = 1;
-        while ((cur = cur->next) && chunks_visited < X.length) {
-            ++chunks_visited;
-            if (cur->value != 0x0) {
-                significant_chunks = chunks_visited;
-            }
-        }
-        return significant_chunks;
-    }(B);
-
-    HardAssert(B.length == iterations);
-
-    ChunkBits Carry = 0;
-
-    for (u32 Idx = 0 ; Idx < iterations; ++Idx) {
-        if (ChunkB->value == MAX_CHUNK_VAL && Carry) {
-            Carry = 1;
-        } else if (ChunkA->value >= ChunkB->value + Carry) {
-            ChunkA->value -= ChunkB->value + Carry;
-            Carry = 0;
-        } else {
-            ChunkA->value += MAX_CHUNK_VAL - (ChunkB->value + Carry) + 1;
-            Carry = 1;
-        }
-        ChunkA = ChunkA->next;
-        ChunkB = ChunkB->next;
-    }
+    i32 LengthB = B.length;
+    ChunkBits Carry = BigDecimal_::sub_chunks(A.chunks, A.chunks, B.chunks, LengthB);
 
     if (Carry) {
-        HardAssert (A.length > B.length);
-        ChunkA->value -= Carry;
-        if (ChunkA->value == 0x0 && A.get_head() == ChunkA) {
-            A.UpdateLength();
-        }
+        HardAssert (A.length > LengthB);
+        Carry = BigDecimal_::sub_chunk(A.chunks + LengthB, A.chunks + LengthB, A.length - LengthB, Carry);
+        HardAssert(Carry == 0);
     }
 
     this->truncate_leading_zero_chunks();
@@ -1136,7 +3449,7 @@ auto BigDecimal<T_Alloc>::sub_integer_unsigned_positive (BigDecimal& B)-> void {
         but the difference may cross zero, i.e. subtrahend may be greater than minuend
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::sub_integer_unsigned (BigDecimal& B)-> void {
+auto BigDecimal<T_Alloc>::sub_integer_unsigned (BigDecimal& B, Workspace& ws)-> void {
 
     HardAssert(this->is_normalized_integer());
 
@@ -1144,11 +3457,11 @@ auto BigDecimal<T_Alloc>::sub_integer_unsigned (BigDecimal& B)-> void {
 
     bool crosses_zero = false;
     if (A.less_than_integer_signed(B)) {
-        A.copy_to(&temp_sub_int_unsign);
+        A.swap(ws.temp_sub_int_unsign, COPY_DIGITS | COPY_SIGN);
         B.copy_to(&A, COPY_DIGITS | COPY_SIGN); //SubInteger does not care about exponent, but callers might, so we keep it intact
         crosses_zero = true;
     }
-    BigDecimal& B_ = crosses_zero ? temp_sub_int_unsign : B;
+    BigDecimal& B_ = crosses_zero ? ws.temp_sub_int_unsign : B;
 
     A.sub_integer_unsigned_positive(B_);
 
@@ -1166,7 +3479,7 @@ auto BigDecimal<T_Alloc>::sub_integer_unsigned (BigDecimal& B)-> void {
         will respect signs, however.
 */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::sub_integer_signed (BigDecimal& B)-> void {
+auto BigDecimal<T_Alloc>::sub_integer_signed (BigDecimal& B, Workspace& ws)-> void {
 
     HardAssert(this->is_normalized_integer());
 
@@ -1174,13 +3487,13 @@ auto BigDecimal<T_Alloc>::sub_integer_signed (BigDecimal& B)-> void {
 
     if (!A.is_negative && !B.is_negative) {
 
-        A.sub_integer_unsigned(B);
+        A.sub_integer_unsigned(B, ws);
 
     } else if (A.is_negative && B.is_negative ) {
 
         A.neg();
         B.neg();
-        A.sub_integer_unsigned(B);
+        A.sub_integer_unsigned(B, ws);
         B.neg();
         A.neg();
 
@@ -1221,51 +3534,29 @@ auto BigDecimal<T_Alloc>::shift_left(u32 ShiftAmount) -> BigDecimal& {
         return *this;
     }
 
-    ChunkList *Head = get_head();
+    ChunkBits *Head = get_head();
 
-    HardAssert(Head->value != 0x0); //TODO(ArokhSlade##2024 08 20): support denormalized numbers?
+    HardAssert(*Head != 0x0); //TODO(ArokhSlade##2024 08 20): support denormalized numbers?
 
     constexpr u32 BitWidth = sizeof(ChunkBits) * 8;
-    u32 OldTopIdx = BitScanReverse<u64>(Head->value);
-    HardAssert(OldTopIdx != BIT_SCAN_NO_HIT);
-    u32 HeadZeros = BitWidth - 1 - OldTopIdx;
+    u32 HeadZeros = BigDecimal_::leading_zeros(*Head);
     i32 Overflow = ShiftAmount - HeadZeros;
 
     u32 NeededChunks = 0;
     if (ShiftAmount > HeadZeros ) {
-        NeededChunks = Overflow / BitWidth; //TODO(ArokhSlade#2024 10 04):replace with DivCeil()
-        if (Overflow % BitWidth != 0) { NeededChunks++; }
+        NeededChunks = DivCeil<u32>(Overflow, BitWidth);
     }
 
-    for (u32 FreeChunks = m_chunks_capacity - length; NeededChunks > FreeChunks; ++FreeChunks) {
-        expand_capacity();
-    }
-    //TODO(ArokhSlade##2024 10 04):can probably just replace this with DstChunk = extend_length(NeededChunks)
-    ChunkList *DstChunk = get_chunk(length-1 + NeededChunks);
-    ChunkList *SrcChunk = Head;
+    reserve_limbs(length + NeededChunks);
 
     u32 Offset = ShiftAmount % BitWidth;
-    u32 NewTopIdx = (OldTopIdx + Offset) % BitWidth;
-
-    if (NewTopIdx < OldTopIdx) {
-        DstChunk->value = SrcChunk->value >> BitWidth-Offset; //NOTE(ArokhSlade##2024 10 06): inside this `if`, Offset cannot be zero, and amount shifted by is guaranteed to be >= 0, < width
-        DstChunk = DstChunk->prev;
-    }
-
-    for (i32 i = 0 ; i < length-1 ; ++i, DstChunk = DstChunk->prev, SrcChunk = SrcChunk->prev) {
-
-        ChunkBits Left = SrcChunk->value << Offset;
-        ChunkBits Right = SafeShiftRight(SrcChunk->prev->value, BitWidth-Offset); //NOTE(ArokhSlade##2024 08 20): regular shift would cause UB when Offset == 0
+    u32 ChunksShifted = ShiftAmount / BitWidth;
 
-        DstChunk->value = Left | Right;
-    }
-
-    HardAssert(SrcChunk == &data);
-    DstChunk->value = SrcChunk->value << Offset;
-
-    for (DstChunk = DstChunk->prev ; DstChunk ; DstChunk = DstChunk->prev) {
-        DstChunk->value = 0x0;
+    ChunkBits Out = BigDecimal_::shift_left_chunks(chunks + ChunksShifted, chunks, length, Offset);
+    if (ChunksShifted + length < length + NeededChunks) {
+        chunks[ChunksShifted + length] = Out; //NOTE(##2026 10 18): the bits that crossed into a new top chunk
     }
+    BigDecimal_::zero_chunks(chunks, ChunksShifted);
 
     length += NeededChunks;
     HardAssert(length <= m_chunks_capacity);
@@ -1298,21 +3589,10 @@ auto BigDecimal<T_Alloc>::shift_right(u32 ShiftAmount) -> BigDecimal& {
     u32 Offset = ShiftAmount % BitWidth;
     i32 ChunksShifted = ShiftAmount / BitWidth;
 
-    ChunkList *Src = get_chunk(ChunksShifted);
-    ChunkList *Dst = &data;
-    i32 IterCount = 0;
-
-    for (i32 i_Src = ChunksShifted  ; i_Src < length-1 ; ++i_Src, ++IterCount) {
-        ChunkBits Right = Src->value >> Offset;
-        ChunkBits Left  = Offset == 0 ? 0x0 : Src->next->value << BitWidth-Offset; //NOTE(ArokhSlade##2024 08 20): x>>y UB for y >= BitWidth. according to standard.
-        Dst->value = Left | Right;
+    BigDecimal_::shift_right_chunks(chunks, chunks + ChunksShifted, length - ChunksShifted, Offset);
 
-        Src = Src->next;
-        Dst = Dst->next;
-    }
-
-    Dst->value = Src->value >> Offset;
-    if (Dst->value) IterCount++;
+    i32 IterCount = length - ChunksShifted;
+    if (chunks[IterCount-1] == 0x0) IterCount--;
 
     length = IterCount;
 
@@ -1321,86 +3601,59 @@ auto BigDecimal<T_Alloc>::shift_right(u32 ShiftAmount) -> BigDecimal& {
     return *this;
 }
 
-template <typename uN>
-void FullMulN(uN A, uN B, uN C[2]);
-
 /**
 \brief  multiply, treat operands as integers, i.e. ignore exponents.
 */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::mul_integer (BigDecimal& B)-> void {
+auto BigDecimal<T_Alloc>::mul_integer (BigDecimal& B, Workspace& ws)-> void {
 
     HardAssert(this->is_normalized_integer());
 
     BigDecimal& A = *this;
-    BigDecimal& carries = temp_mul_int_carries;
-    BigDecimal& result = temp_mul_int_0;
-    BigDecimal& row_result = temp_mul_int_1;
+    BigDecimal& result = ws.temp_mul_int_0;
 
 //    if (A.is_zero() || B.is_zero()) {
 //        this->zero(); //TODO(ArokhSlade##2024 10 19): sign!
 //        return;
 //    }
 
-	carries.zero();
-	result.zero();
-
-	ChunkList *chunk_A = &A.data;
-	for (u32 IdxA = 0 ; IdxA < A.length ; ++IdxA, chunk_A = chunk_A->next) {
-        HardAssert(chunk_A != nullptr);
-        ChunkList *chunk_B = &B.data;
-
-	    row_result.zero();
-	    ChunkList *chunk_row_result = &row_result.data;
-        u32 carriesActualLength = 1;
-        carries.zero();
-//        if (chunk_A->value != 0x0) {
-            ChunkList *chunk_carries = &carries.data;
-            while (carries.length <= IdxA) {
-                carries.extend_length();
-                chunk_carries = chunk_carries->next;
-            }
-            for (u32 IdxB = 0 ; IdxB < B.length ; ++IdxB, chunk_B = chunk_B->next) {
-                HardAssert(chunk_B != nullptr);
-                ChunkBits ChunkProd[2] = {};
-                FullMulN<ChunkBits>(chunk_A->value, chunk_B->value, ChunkProd);
-                while (row_result.length-1 < IdxA + IdxB) {
-                    row_result.extend_length();
-                }
-                chunk_row_result = row_result.get_chunk(IdxA+IdxB);
-                chunk_row_result->value = ChunkProd[0];
-
-                carries.extend_length();
-                chunk_carries = chunk_carries->next;
-                HardAssert(chunk_carries != nullptr);
-                chunk_carries->value = ChunkProd[1];
-                carriesActualLength = ChunkProd[1] != 0 ? carries.length : carriesActualLength;
-            }
-            HardAssert(row_result.length >= IdxA + B.length);
-            HardAssert(carries.length >= row_result.length);
-            chunk_carries = &carries.data;
-            for (u32 CheckIdx = 0; CheckIdx <= IdxA ; CheckIdx++) {
-                HardAssert(chunk_carries != nullptr);
-                chunk_carries->value == 0; //TODO(ArokhSlade##2024 09 23): no-op. intent? assert, i think. because there can't be carry values for the chunks below-or-equal IdxA
-                chunk_carries = chunk_carries->next;
-            }
-            carries.length = carriesActualLength;
+    A.mul_integer_to(B, result, ws);
+	A.swap(result); //NOTE(##2026 10 18): hand the product over, the temporary keeps A's old block for the next call
+
+	HardAssert(this->is_normalized_integer());
+
+    return;
+}
 
-            row_result.UpdateLength();
+/**
+\brief  Product = this * B as integers, exponents are ignored, Product's exponent is left unchanged.
+\note   Product must be neither this nor B. this and B are left unchanged.
+*/
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::mul_integer_to (BigDecimal& B, BigDecimal& Product, Workspace& ws)-> void {
 
-            HardAssert(row_result.is_normalized_integer());
-            HardAssert(carries.is_normalized_integer());
-            HardAssert(result.is_normalized_integer());
+    HardAssert(this->is_normalized_integer());
+    HardAssert(&Product != this && &Product != &B);
 
-            row_result.add_integer_signed(carries);
-            result.add_integer_signed(row_result);
-//        }
-	}
+    BigDecimal& A = *this;
 
-	result.is_negative = A.is_negative != B.is_negative;
-	result.copy_to(&A);
+    i32 ResultLength = A.length + B.length;
+    Product.zero();
+    Product.reserve_limbs(ResultLength);
 
-	HardAssert(this->is_normalized_integer());
+    //NOTE(##2026 10 18): mul_chunks picks schoolbook/Karatsuba/Toom by size, see BigDecimal_::mul_thresholds. A may be B.
+    i32 ScratchLength = BigDecimal_::mul_chunks_scratch_size(A.length, B.length);
+    BigDecimal& scratch = ws.temp_mul_int_scratch;
+    scratch.reserve_limbs(ScratchLength);
+    BigDecimal_::ChunkScratch Scratch {scratch.chunks, scratch.chunks + scratch.m_chunks_capacity};
+
+    BigDecimal_::mul_chunks(Product.chunks, A.chunks, A.length, B.chunks, B.length, Scratch);
+    Product.length = ResultLength;
+    Product.truncate_leading_zero_chunks();
+
+	Product.is_negative = A.is_negative != B.is_negative;
+
+	HardAssert(Product.is_normalized_integer());
 
     return;
 }
@@ -1417,9 +3670,9 @@ auto BigDecimal<T_Alloc>::get_msb() -> i32 {
     HardAssert(is_normalized_integer());
 
     if (is_zero()) return 0;
-    typename BigDecimal<T_Alloc>::ChunkList *Cur = get_head();
+    ChunkBits *Cur = get_head();
     i32 Result = 0;
-    Result = BitScanReverse<ChunkBits>(Cur->value) + (length-1) * CHUNK_WIDTH;
+    Result = CHUNK_WIDTH - 1 - static_cast<i32>(BigDecimal_::leading_zeros(*Cur)) + (length-1) * CHUNK_WIDTH;
     return Result;
 
 }
@@ -1443,8 +3696,7 @@ auto BigDecimal<T_Alloc>::get_bit(i32 high_idx) -> bool {
     i32 chunk_idx = low_idx / CHUNK_WIDTH;
     i32 bit_idx = low_idx % CHUNK_WIDTH;
 
-    ChunkList* chunk = get_chunk(chunk_idx);
-    bool result = chunk->value & (ChunkBits(1) << bit_idx);
+    bool result = chunks[chunk_idx] & (ChunkBits(1) << bit_idx);
     return result;
 }
 
@@ -1455,35 +3707,44 @@ auto BigDecimal<T_Alloc>::count_bits() -> i32 {
 }
 
 /**
-\brief performs round-to-even with guard bit, round bit and sticky bits (any 1 after the round bit counts as sticky bit set)
+\brief performs rounding to N significant bits with guard bit, round bit and sticky bits (any 1 after the round bit counts as sticky bit set)
+\note  Mode NEAREST_EVEN is round-to-even, the directed modes round up whenever any dropped bit is set and the direction says so.
  */
 template<typename T_Alloc>
-auto BigDecimal<T_Alloc>::round_to_n_significant_bits(i32 N) -> void {
-    HardAssert(this->is_normalized_fractional());
+auto BigDecimal<T_Alloc>::round_to_n_significant_bits(i32 N, BigDecimal_::RoundingMode Mode, Workspace& ws) -> void {
+    using BigDecimal_::RoundingMode;
+    HardAssert(this->is_fractional());
     i32 BitCount = this->count_bits();
     if (BitCount <= N) return;
 
     i32 LSB = N==0 ? 0 : get_bit(N-1);
     i32 Guard = get_bit(N);
-    // we know: this->is_normalized_fractional(), therefor LSB == 1
     // for explanation sake, assume bits are numbered front to back, i.e. LSB at [0]
     // we will round to N bits, i.e. indices [0..N-1]
     // bit[N] = Guard bit
     // bit[N+1] = Round bit
     // Sticky bit is set if any bit thereafter is set to true
-    // thus, if we have N+3 or more bits, sticky bit is set.
-    // Round OR Sticky bit is set, if we have N+2 or more bits.
-    i32 RoundSticky = BitCount >  N + 1 ;
+    // the lowest bits may be trailing zeros (see normalize_chunks()), so Round OR Sticky is looked up, not counted.
+    i32 Drop = BitCount - N;
+    bool RoundSticky = BigDecimal_::any_bits_below(chunks, length, Drop - 1);
 
-    shift_right(BitCount-N);
+    shift_right(Drop);
 
     //GRS:100 = midway, round if lsb is set, i.e. "uneven"
     //all other cases are determined:
     //GRS:0xx = round down
     //Guard bit set followed by a 1 anywhere later ("round or sticky") = round up
-    bool RoundUp = Guard && (RoundSticky || LSB); //NOTE(Arokh##2024 07 14): round-to-even
+    bool Inexact = Guard || RoundSticky;
+    bool RoundUp = false;
+    switch (Mode) {
+        case RoundingMode::NEAREST_EVEN: RoundUp = Guard && (RoundSticky || LSB); break; //NOTE(Arokh##2024 07 14): round-to-even
+        case RoundingMode::TOWARD_ZERO:  RoundUp = false; break;
+        case RoundingMode::UP:           RoundUp = Inexact && !is_negative; break;
+        case RoundingMode::DOWN:         RoundUp = Inexact && is_negative; break;
+        case RoundingMode::AWAY:         RoundUp = Inexact; break;
+    }
     if (RoundUp) {
-        add_integer_unsigned(temp_one);
+        add_integer_unsigned(ws.temp_one);
     }
 
     i32 NewBitCount = this->count_bits();
@@ -1498,8 +3759,53 @@ auto BigDecimal<T_Alloc>::round_to_n_significant_bits(i32 N) -> void {
 }
 
 
+/**
+\brief  quotient and remainder of unsigned integers: this = this mod B, Quotient = this / B.
+        signs and exponents are ignored and left unchanged.
+\note   B must not be zero. Quotient must be neither this nor B.
+ */
 template <typename T_Alloc>
-auto div_integer(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Alloc>& ResultInteger, BigDecimal<T_Alloc>& ResultFraction, u32 MinFracPrecision=32) -> bool{
+auto BigDecimal<T_Alloc>::div_rem_integer_unsigned (BigDecimal& B, BigDecimal& Quotient, Workspace& ws) -> void {
+
+    HardAssert(this->is_normalized_integer());
+    HardAssert(B.is_normalized_integer());
+    HardAssert(!B.is_zero());
+    HardAssert(&Quotient != this && &Quotient != &B);
+
+    BigDecimal& A = *this;
+    Quotient.zero();
+    if (A.length < B.length) {
+        return;
+    }
+
+    i32 QuotientLength = A.length - B.length + 1;
+    Quotient.reserve_limbs(QuotientLength);
+
+    i32 ScratchLength = BigDecimal_::div_chunks_scratch_size(A.length, B.length);
+    BigDecimal& scratch = ws.temp_div_int_0;
+    scratch.reserve_limbs(ScratchLength);
+    BigDecimal_::ChunkScratch Scratch {scratch.chunks, scratch.chunks + scratch.m_chunks_capacity};
+
+    BigDecimal_::div_chunks(Quotient.chunks, A.chunks, A.length, B.chunks, B.length, Scratch);
+
+    Quotient.length = QuotientLength;
+    Quotient.truncate_leading_zero_chunks();
+    A.truncate_leading_zero_chunks();
+
+    return;
+}
+
+
+/**
+\brief  divides A by B as integers.
+        ResultInteger gets the integer part of the quotient (with sign, exponent == count_bits()-1).
+        ResultFraction gets the fraction part in fractional format: it starts at the first 1 bit after the point
+        and extends to the first 1 bit after at least MinFracPrecision bits, or ends early if the division is exact.
+\return whether B was zero
+ */
+template <typename T_Alloc>
+auto div_integer(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Alloc>& ResultInteger, BigDecimal<T_Alloc>& ResultFraction,
+                 typename BigDecimal<T_Alloc>::Workspace& ws, u32 MinFracPrecision=32) -> bool{
 
     HardAssert(A.is_normalized_integer());
     HardAssert(B.is_normalized_integer());
@@ -1511,125 +3817,81 @@ auto div_integer(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Al
     }
 
     using T_Big_Decimal = BigDecimal<T_Alloc>;
-    ResultInteger.set(0);
     ResultFraction.set(0);
 
-    int DigitCountB = B.count_bits();
-    bool IntegerPartDone = false;
-    bool NonZeroInteger = false;
-
-    T_Big_Decimal& A_    = T_Big_Decimal::temp_div_int_a;
-    T_Big_Decimal& B_    = T_Big_Decimal::temp_div_int_b;
-    T_Big_Decimal& One_  = T_Big_Decimal::temp_one;
-    T_Big_Decimal& Temp_ = T_Big_Decimal::temp_div_int_0;
+    T_Big_Decimal& A_    = ws.temp_div_int_a;
+    T_Big_Decimal& B_    = ws.temp_div_int_b;
     A.copy_to(&A_);
     B.copy_to(&B_);
     A_.is_negative = B_.is_negative = false;
 
 
-    //Compute Integer Part
-
-    if ( A_.greater_equals_integer(B_) ) {
-        NonZeroInteger = true;
-        for ( ; !A_.is_zero() && !IntegerPartDone ; ) {
-            int DigitCountA = A_.count_bits();
-            int Diff = DigitCountA - DigitCountB;
-
-            if (Diff > 0) {
-                B_.shift_left(Diff);
-                if (A_.less_than_integer_signed(B_)){
-                    B_.shift_right(1);
-                    Diff -= 1;
-                }
-                Temp_.set(1);
-                Temp_.shift_left(Diff);
-                ResultInteger.add_integer_signed(Temp_);
-                A_.sub_integer_signed(B_);
-                B.copy_to(&B_, T_Big_Decimal::COPY_DIGITS | T_Big_Decimal::COPY_EXPONENT); //Don't copy Sign
-            }
-            else if (Diff == 0) {
-                if ( A_.greater_equals_integer(B_) ) {
-                    A_.sub_integer_signed(B_);
-                    ResultInteger.add_integer_signed(One_);
-                } else {
-                    IntegerPartDone = true;
-                }
-            } else {
-                IntegerPartDone = true; //A.#Digits < B.#NumDigits => A/B = 0.something
-            }
-        }
-        if (A_.is_zero()) {
-            return was_div_by_zero;
-        }
-    }
-    else { IntegerPartDone = true; }
+    //Compute Integer Part, A_ keeps the remainder
 
+    A_.div_rem_integer_unsigned(B_, ResultInteger, ws);
     ResultInteger.exponent = ResultInteger.count_bits() - 1;
+    ResultInteger.is_negative = A.is_negative != B.is_negative;
 
-    i32 DigitCountA = A_.count_bits();
-    i32 RevDiff = DigitCountB-DigitCountA;
-    A_.shift_left(RevDiff);
-    if (A_.less_than_integer_signed(B_)) {
-        A_.shift_left(1);
-        RevDiff += 1;
+    if (A_.is_zero()) {
+        return was_div_by_zero;
     }
 
-    ResultFraction.set(0x1, false, -RevDiff);
-    i32 ExplicitSignificantFractionBits = 1 ;
-    A_.sub_integer_signed(B_);
 
     //Compute Fraction Part
-    for ( ; ExplicitSignificantFractionBits < MinFracPrecision && !A_.is_zero() ; ) {
-        int DigitCountA = A_.count_bits();
-        int RevDiff = DigitCountB-DigitCountA;
-        HardAssert(RevDiff >= 0);
-        if (RevDiff == 0) {
-            HardAssert(A_.less_than_integer_signed(B_));
 
+    i32 DigitCountB = B_.count_bits();
+    auto shift_to_next_one = [&A_, &B_, DigitCountB]() -> i32 { //NOTE(##2026 10 18): distance to the next 1 bit of the quotient, i.e. until the remainder exceeds B_
+        i32 Shift = DigitCountB - A_.count_bits();
+        A_.shift_left(Shift);
+        if (A_.less_than_integer_unsigned(B_)) {
             A_.shift_left(1);
-            ExplicitSignificantFractionBits += 1;
-            ResultFraction.shift_left(1);
-            ResultFraction.add_integer_signed(One_);
-            A_.sub_integer_signed(B_);
-        } else if (RevDiff > 0) {
-            A_.shift_left(RevDiff);
-            if (A_.less_than_integer_signed(B_)) {
-                A_.shift_left(1);
-                RevDiff += 1;
-            }
-            ExplicitSignificantFractionBits += RevDiff;
-            ResultFraction.shift_left(RevDiff);
-            ResultFraction.add_integer_signed(One_);
-            A_.sub_integer_signed(B_);
+            Shift += 1;
         }
-    }
+        return Shift;
+    };
+
+    i32 LeadingZeros = shift_to_next_one();
+    i32 FractionBits = MinFracPrecision > 1 ? MinFracPrecision : 1;
+    A_.shift_left(FractionBits - 1);
+    A_.div_rem_integer_unsigned(B_, ResultFraction, ws);
 
-    ResultInteger.is_negative = A.is_negative && !B.is_negative || !A.is_negative && B.is_negative;
+    if ((ResultFraction.chunks[0] & 0x1) == 0x0 && !A_.is_zero()) {
+        ResultFraction.shift_left(shift_to_next_one());
+        ResultFraction.chunks[0] |= 0x1;
+    }
+    ResultFraction.normalize();
+    ResultFraction.exponent = -LeadingZeros;
 
     return was_div_by_zero;
 }
 
+template <typename T_Alloc>
+auto div_integer(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Alloc>& ResultInteger, BigDecimal<T_Alloc>& ResultFraction, u32 MinFracPrecision=32) -> bool{
+    return div_integer(A, B, ResultInteger, ResultFraction, BigDecimal<T_Alloc>::workspace(), MinFracPrecision);
+}
+
 /**
 \brief  integer division, treat operands as integers, i.e. ignore their exponents.
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::div_integer (BigDecimal& B, u32 MinFracPrecision) -> void {
+auto BigDecimal<T_Alloc>::div_integer (BigDecimal& B, Workspace& ws, u32 MinFracPrecision) -> void {
 
     HardAssert(this->is_normalized_integer());
 
-    ::div_integer(*this, B, temp_div_frac_int_part, temp_div_frac_frac_part, MinFracPrecision);
+    ::div_integer(*this, B, ws.temp_div_frac_int_part, ws.temp_div_frac_frac_part, ws, MinFracPrecision);
 
-    HardAssert(temp_div_frac_frac_part.is_zero() || temp_div_frac_frac_part.exponent < 0 );
-    HardAssert(temp_div_frac_int_part.is_zero() || temp_div_frac_int_part.exponent >=0);
+    HardAssert(ws.temp_div_frac_frac_part.is_zero() || ws.temp_div_frac_frac_part.exponent < 0 );
+    HardAssert(ws.temp_div_frac_int_part.is_zero() || ws.temp_div_frac_int_part.exponent >=0);
 
-    temp_div_frac_int_part.copy_to(this, BigDecimal::COPY_DIGITS | BigDecimal::COPY_EXPONENT);
+    this->swap(ws.temp_div_frac_int_part, BigDecimal::COPY_DIGITS | BigDecimal::COPY_EXPONENT);
 
     this->is_negative = false;
+    this->normalize_chunks(); //NOTE(##2026 10 18): integer parts like 2^64 have trailing zero chunks, add_fractional expects fractional format
 
-    HardAssert(!temp_div_frac_frac_part.is_negative);
-    this->add_fractional(temp_div_frac_frac_part);
+    HardAssert(!ws.temp_div_frac_frac_part.is_negative);
+    this->add_fractional(ws.temp_div_frac_frac_part, ws, BigDecimal_::RoundingContext{});
 
-    this->is_negative = temp_div_frac_int_part.is_negative;
+    this->is_negative = ws.temp_div_frac_int_part.is_negative;
 
     HardAssert(this->is_normalized_integer());
 
@@ -1638,95 +3900,294 @@ auto BigDecimal<T_Alloc>::div_integer (BigDecimal& B, u32 MinFracPrecision) -> v
 
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::get_least_significant_exponent() -> i32 {
-    HardAssert(is_normalized_fractional());
+    HardAssert(is_fractional());
     return (exponent-this->count_bits())+1;
 }
 
 
+/**
+\brief  for A + B or A - B rounded to Precision bits: if one operand lies entirely below the bits that the rounding of the
+        other one can tell apart, replaces it by a single 1 bit of the same sign just below them.
+        the sum rounds the same in every mode, but the bigger operand no longer needs to be shifted down to the smaller one.
+\note   both operands are modified, pass copies, i.e. the destination and a temporary.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::collapse_far_operand(BigDecimal& A, BigDecimal& B, i32 Precision) -> void {
+    if (Precision <= 0 || A.is_zero() || B.is_zero()) return;
+    BigDecimal& Big   = A.exponent >= B.exponent ? A : B;
+    BigDecimal& Small = A.exponent >= B.exponent ? B : A;
+    //NOTE(##2026 10 18): the bits of Big, and its rounding boundaries also after losing its leading bit to a subtraction,
+    //                    all lie on multiples of 2^(Pos+1). Big +- Small and Big +- 2^Pos stay strictly between the same two.
+    i32 Pos = std::min(Big.get_least_significant_exponent() - 1, Big.exponent - Precision - 3);
+    if (Small.exponent > Pos) return;
+    if (Small.exponent == Pos && Small.length == 1 && Small.chunks[0] == 0x1) return;
+    Small.set(1u, Small.is_negative, Pos);
+}
+
+
+/**
+\brief  this = Src[0..Count), scaled so its least significant bit has exponent LeastSignificantExponent
+\note   zero becomes +0 with exponent 0
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::set_small_chunks(ChunkBits const *Src, i32 Count, bool IsNegative, i32 LeastSignificantExponent) -> void {
+    i32 Length = Count;
+    while (Length > 1 && Src[Length-1] == 0x0) --Length;
+    if (Length == 1 && Src[0] == 0x0) {
+        set(0u);
+        return;
+    }
+    reserve_limbs(Length);
+    BigDecimal_::copy_chunks(chunks, Src, Length);
+    length = Length;
+    is_negative = IsNegative;
+    exponent = LeastSignificantExponent + get_msb();
+    normalize_chunks();
+}
+
+/**
+\brief  this = this + B, or this - B for NegateB, when both are non-zero, have at most two chunks each and fit three
+        chunks once aligned
+\return false without touching this if they don't, the general algorithm takes over then
+\note   B may be this
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::add_small_chunks(BigDecimal& B, bool NegateB) -> bool {
+    constexpr i32 WIDE_COUNT = 3;
+    BigDecimal& A = *this;
+    if (A.length > 2 || B.length > 2 || A.is_zero() || B.is_zero()) return false;
+
+    i32 MsbA = A.get_msb();
+    i32 MsbB = B.get_msb();
+    i32 LseA = A.exponent - MsbA;
+    i32 LseB = B.exponent - MsbB;
+    i32 Lse = std::min(LseA, LseB);
+    //NOTE(##2026 10 18): the top bit stays free for the carry
+    if (MsbA + (LseA - Lse) >= WIDE_COUNT*CHUNK_WIDTH - 1 || MsbB + (LseB - Lse) >= WIDE_COUNT*CHUNK_WIDTH - 1) return false;
+
+    ChunkBits WideA[WIDE_COUNT], WideB[WIDE_COUNT], Sum[WIDE_COUNT];
+    BigDecimal_::widen_chunks(A.chunks, A.length, LseA - Lse, WideA, WIDE_COUNT);
+    BigDecimal_::widen_chunks(B.chunks, B.length, LseB - Lse, WideB, WIDE_COUNT);
+    bool NegativeB = B.is_negative != NegateB;
+    bool IsNegative = A.is_negative;
+    if (A.is_negative == NegativeB) {
+        ChunkBits Carry = 0x0;
+        for (i32 Idx = 0 ; Idx < WIDE_COUNT ; ++Idx) Carry = BigDecimal_::add_carry(Carry, WideA[Idx], WideB[Idx], &Sum[Idx]);
+    } else {
+        i32 Top = WIDE_COUNT - 1;
+        while (Top > 0 && WideA[Top] == WideB[Top]) --Top;
+        bool BIsBigger = WideB[Top] > WideA[Top];
+        ChunkBits const *Big   = BIsBigger ? WideB : WideA;
+        ChunkBits const *Small = BIsBigger ? WideA : WideB;
+        ChunkBits Borrow = 0x0;
+        for (i32 Idx = 0 ; Idx < WIDE_COUNT ; ++Idx) Borrow = BigDecimal_::sub_borrow(Borrow, Big[Idx], Small[Idx], &Sum[Idx]);
+        if (BIsBigger) IsNegative = NegativeB;
+    }
+    set_small_chunks(Sum, WIDE_COUNT, IsNegative, Lse);
+    return true;
+}
+
+
 /**
 \brief addition algorithm that treats operands as fractionals.
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::add_fractional (BigDecimal& B) -> void {
+auto BigDecimal<T_Alloc>::add_fractional (BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding) -> void {
     BigDecimal& A = *this;
-    HardAssert(A.is_normalized_fractional());
-    HardAssert(B.is_normalized_fractional());
+    HardAssert(A.is_fractional());
+    HardAssert(B.is_fractional());
+    if (add_small_chunks(B, false)) {
+        round_to(Rounding, ws);
+        return;
+    }
+    BigDecimal& B_ = ws.temp_add_fractional;
+    B.copy_to(&B_);
+    collapse_far_operand(A, B_, Rounding.precision);
     int A_LSE = A.get_least_significant_exponent();
-    int B_LSE = B.get_least_significant_exponent();
+    int B_LSE = B_.get_least_significant_exponent();
     int Diff = A_LSE - B_LSE;
-    BigDecimal& B_ = temp_add_fractional;
+    if (Diff > 0 ) {
+        A.shift_left(Diff);
+    }
+    if (Diff < 0) {
+        B_.shift_left(-Diff);
+    }
+    int OldMSB = A.get_msb();
+    bool WasZero = A.is_zero();
+    A.add_integer_signed(B_, ws);
+    int NewMSB = A.get_msb();
+    A.exponent = WasZero ? B_.exponent : A.exponent+(NewMSB-OldMSB);
+    normalize_chunks();
+    round_to(Rounding, ws);
+
+    return;
+}
+
+
+/**
+\brief subtraction algorithm that treats operands as fractionals.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::sub_fractional (BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding)-> void {
+    HardAssert(is_fractional());
+    HardAssert(B.is_fractional());
+    if (add_small_chunks(B, true)) {
+        round_to(Rounding, ws);
+        return;
+    }
+    BigDecimal& A = *this;
+    BigDecimal& B_ = ws.temp_sub_frac;
     B.copy_to(&B_);
+    collapse_far_operand(A, B_, Rounding.precision);
+    int A_LSE = A.get_least_significant_exponent();
+    int B_LSE = B_.get_least_significant_exponent();
+    int Diff = A_LSE - B_LSE;
     if (Diff > 0 ) {
         A.shift_left(Diff);
     }
     if (Diff < 0) {
         B_.shift_left(-Diff);
     }
-    int OldMSB = A.get_msb();
-    bool WasZero = A.is_zero();
-    A.add_integer_signed(B_);
-    int NewMSB = A.get_msb();
-    A.exponent = WasZero ? B_.exponent : A.exponent+(NewMSB-OldMSB);
-    normalize();
+    int OldMSB = get_msb();
+    A.sub_integer_signed(B_, ws);
+    int NewMSB = get_msb();
+    A.exponent += (NewMSB-OldMSB);
+    normalize_chunks();
+    round_to(Rounding, ws);
+
+    return;
+}
+
+
+/**
+\brief multiply algorithm that treats operands as fractionals.
+ */
+template <typename T_Alloc>
+auto BigDecimal<T_Alloc>::mul_fractional(BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding) -> void {
+    HardAssert(is_fractional());
+    HardAssert(B.is_fractional());
+    BigDecimal& A = *this;
+    if (A.length <= 2 && B.length <= 2 && !A.is_zero() && !B.is_zero()) {
+        //NOTE(##2026 10 18): schoolbook on at most 2x2 chunks, the dispatched kernels don't pay off at this size
+        ChunkBits Product[4];
+        i32 Lse = A.get_least_significant_exponent() + B.get_least_significant_exponent();
+        Product[A.length] = BigDecimal_::mul_chunk_generic(Product, A.chunks, A.length, B.chunks[0]);
+        if (B.length == 2) Product[A.length+1] = BigDecimal_::addmul_chunk_generic(Product + 1, A.chunks, A.length, B.chunks[1]);
+        set_small_chunks(Product, A.length + B.length, A.is_negative != B.is_negative, Lse);
+        round_to(Rounding, ws);
+        return;
+    }
+    int exponent_ = A.exponent + B.exponent - A.get_msb() - B.get_msb();
+    A.mul_integer(B, ws);
+	A.exponent = exponent_ + A.get_msb(); //NOTE(##2026 10 18): before normalize_chunks(), the product of operands with trailing zeros has trailing zeros
+    normalize_chunks();
+    round_to(Rounding, ws);
+
+    return;
+}
+
+
+/**
+\brief  fused multiply-add of fractionals: Result = A * B + C, exact, then rounded once to Rounding (no rounding for precision 0).
+\note   the product stays in the multiply kernel's buffer and is aligned there, C is added directly unless it is the one
+        that needs shifting. no intermediate normalize, and A * B is never copied.
+\note   Result may be any of A, B, C, it is only written once the sum is complete.
+ */
+template <typename T_Alloc>
+auto fma(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Alloc>& C, BigDecimal<T_Alloc>& Result,
+         typename BigDecimal<T_Alloc>::Workspace& ws, BigDecimal_::RoundingContext const& Rounding) -> void {
+
+    HardAssert(A.is_fractional());
+    HardAssert(B.is_fractional());
+    HardAssert(C.is_fractional());
+
+    using T_Big_Decimal = BigDecimal<T_Alloc>;
+
+    if (A.is_zero() || B.is_zero()) {
+        if (&Result != &C) C.copy_to(&Result);
+    } else {
+        T_Big_Decimal& Product = ws.temp_mul_int_0;
+        i32 ProductLSE = A.get_least_significant_exponent() + B.get_least_significant_exponent();
+        A.mul_integer_to(B, Product, ws);
+
+        T_Big_Decimal *Addend = &C;
+        if (Rounding.precision > 0 && !C.is_zero()) {
+            //NOTE(##2026 10 18): an addend far below the product, or a product far below the addend, only counts as sticky bit
+            T_Big_Decimal& C_ = ws.temp_add_fractional;
+            C.copy_to(&C_);
+            Product.exponent = ProductLSE + Product.get_msb();
+            Product.normalize_chunks();
+            T_Big_Decimal::collapse_far_operand(Product, C_, Rounding.precision);
+            ProductLSE = Product.get_least_significant_exponent();
+            Addend = &C_;
+        }
+
+        i32 Base = ProductLSE;
+        if (!Addend->is_zero()) {
+            i32 AddendLSE = Addend->get_least_significant_exponent();
+            if (AddendLSE > ProductLSE) {
+                T_Big_Decimal& C_ = ws.temp_add_fractional;
+                if (Addend != &C_) Addend->copy_to(&C_);
+                C_.shift_left(AddendLSE - ProductLSE);
+                Product.add_integer_signed(C_, ws);
+            } else {
+                Product.shift_left(ProductLSE - AddendLSE);
+                Product.add_integer_signed(*Addend, ws);
+                Base = AddendLSE;
+            }
+        }
+
+        if (Product.is_zero()) {
+            Product.is_negative = false;
+            Product.exponent = 0;
+        } else {
+            Product.exponent = Base + Product.get_msb();
+            Product.normalize_chunks();
+        }
+        Result.swap(Product);
+    }
 
-    return;
+    Result.round_to(Rounding, ws);
 }
 
-
 /**
-\brief subtraction algorithm that treats operands as fractionals.
+\brief  fma rounded to RoundToBits significant bits in the rounding mode of the workspace,
+        or to the workspace's rounding context for RoundToBits <= 0 (exact by default).
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::sub_fractional (BigDecimal& B)-> void {
-    HardAssert(is_normalized_fractional());
-    BigDecimal& A = *this;
-    int A_LSE = A.get_least_significant_exponent();
-    int B_LSE = B.get_least_significant_exponent();
-    int Diff = A_LSE - B_LSE;
-    BigDecimal& B_ = BigDecimal<T_Alloc>::temp_sub_frac;
-    B.copy_to(&B_);
-    if (Diff > 0 ) {
-        A.shift_left(Diff);
-    }
-    if (Diff < 0) {
-        B_.shift_left(-Diff);
-    }
-    int OldMSB = get_msb();
-    A.sub_integer_signed(B_);
-    int NewMSB = get_msb();
-    A.exponent += (NewMSB-OldMSB);
-    normalize();
-
-    return;
+auto fma(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Alloc>& C, BigDecimal<T_Alloc>& Result,
+         typename BigDecimal<T_Alloc>::Workspace& ws, i32 RoundToBits=0) -> void {
+    BigDecimal_::RoundingContext Rounding = ws.rounding;
+    if (RoundToBits > 0) Rounding.precision = RoundToBits;
+    fma(A, B, C, Result, ws, Rounding);
 }
 
+template <typename T_Alloc>
+auto fma(BigDecimal<T_Alloc>& A, BigDecimal<T_Alloc>& B, BigDecimal<T_Alloc>& C, BigDecimal<T_Alloc>& Result, i32 RoundToBits=0) -> void {
+    fma(A, B, C, Result, BigDecimal<T_Alloc>::workspace(), RoundToBits);
+}
 
 /**
-\brief multiply algorithm that treats operands as fractionals.
+\brief  this = this * B + C with a single rounding, see fma.
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::mul_fractional(BigDecimal& B) -> void {
-    HardAssert(is_normalized_fractional());
-    HardAssert(B.is_normalized_fractional());
-    BigDecimal& A = *this;
-    int exponent_ = A.exponent + B.exponent - A.get_msb() - B.get_msb();
-    A.mul_integer(B);
-    normalize();
-	A.exponent = exponent_ + A.get_msb();
-
-    return;
+auto BigDecimal<T_Alloc>::fma_fractional(BigDecimal& B, BigDecimal& C, Workspace& ws, i32 RoundToBits) -> void {
+    ::fma(*this, B, C, *this, ws, RoundToBits);
 }
 
 
 /**
 \brief division algorithm that treats operands as fractionals.
+\note  with a precision in Rounding, the quotient is computed to that many bits plus guard and round bit, the remainder
+       only decides the sticky bit, and MinFracPrecision doesn't matter. otherwise the quotient is exact or has at least
+       MinFracPrecision bits after the point.
  */
 template <typename T_Alloc>
-auto BigDecimal<T_Alloc>::div_fractional (BigDecimal& B, u32 MinFracPrecision) -> void {
+auto BigDecimal<T_Alloc>::div_fractional (BigDecimal& B, Workspace& ws, BigDecimal_::RoundingContext const& Rounding, u32 MinFracPrecision) -> void {
 
     BigDecimal& A = *this;
-    HardAssert(A.is_normalized_fractional());
-    HardAssert(B.is_normalized_fractional());
+    HardAssert(A.is_fractional());
+    HardAssert(B.is_fractional());
 
     if (B.is_zero()) {
         A.was_divided_by_zero = true;
@@ -1737,21 +4198,237 @@ auto BigDecimal<T_Alloc>::div_fractional (BigDecimal& B, u32 MinFracPrecision) -
     int B_LSE = B.get_least_significant_exponent();
     int Diff = A_LSE - B_LSE;
 
-    BigDecimal& B_ = BigDecimal<T_Alloc>::temp_div_frac;
+    if (Rounding.precision > 0 && A.length <= 2 && B.length == 1 && !A.is_zero()) {
+        //NOTE(##2026 10 18): as below, with the shifted dividend in two chunks and a single chunk divisor.
+        //a two chunk divisor takes the general path, its quotient needs the long division of div_rem_integer_unsigned
+        i32 Shift = std::max(Rounding.precision + 2 + B.count_bits() - A.count_bits(), 0);
+        if (A.get_msb() + Shift < 2*CHUNK_WIDTH) {
+            ChunkBits Dividend[2], Quotient[2];
+            BigDecimal_::widen_chunks(A.chunks, A.length, Shift, Dividend, 2);
+            if (BigDecimal_::div_chunk(Quotient, Dividend, 2, B.chunks[0]) != 0x0) {
+                Quotient[0] |= 0x1;
+            }
+            set_small_chunks(Quotient, 2, A.is_negative != B.is_negative, Diff - Shift);
+            round_to(Rounding, ws);
+            return;
+        }
+    }
+
+    BigDecimal& B_ = ws.temp_div_frac;
     B.copy_to(&B_);
+
+    if (Rounding.precision > 0) {
+        if (A.is_zero()) return;
+        //NOTE(##2026 10 18): A * 2^Shift / B has precision+2 or precision+3 bits, see parse_fraction
+        i32 Shift = Rounding.precision + 2 + B_.count_bits() - A.count_bits();
+        if (Shift < 0) Shift = 0;
+        A.shift_left(Shift);
+        BigDecimal& Quotient = ws.temp_div_frac_int_part;
+        A.div_rem_integer_unsigned(B_, Quotient, ws);
+        if (!A.is_zero()) {
+            Quotient.chunks[0] |= 0x1; //NOTE(##2026 10 18): below the round bit, so it only acts as sticky bit
+        }
+        Quotient.exponent = Diff - Shift + Quotient.get_msb();
+        Quotient.is_negative = A.is_negative != B.is_negative;
+        A.swap(Quotient);
+        normalize_chunks();
+        round_to(Rounding, ws);
+        return;
+    }
+
     if (Diff > 0 ) {
         A.shift_left(Diff);
     }
     if (Diff < 0) {
         B_.shift_left(-Diff);
     }
-    A.div_integer( B_, MinFracPrecision );
-    normalize();
+    A.div_integer( B_, ws, MinFracPrecision );
+    normalize_chunks();
 
     return;
 }
 
 
+/**
+ *  \brief  leaf of an expression, refers to an operand that must outlive the expression.
+ *  \note   only lvalues become leaves, see BigDecimalOperand::wrap.
+ */
+template <typename T_Alloc>
+struct BigDecimalRef {
+    using BigDec = BigDecimal<T_Alloc>;
+    using Workspace = typename BigDec::Workspace;
+    static constexpr bool IS_BIG_DECIMAL_EXPR = true;
+    static constexpr bool IS_LEAF = true;
+    static constexpr bool IS_FUSABLE_PRODUCT = false;
+
+    BigDec const *value;
+
+    //NOTE(##2026 10 18): the fractional arithmetic only reads its operands, but takes them as BigDecimal&
+    auto operand() const -> BigDec& { return const_cast<BigDec&>(*value); }
+
+    auto eval_into(BigDec& Dst, [[maybe_unused]] Workspace& ws, [[maybe_unused]] i32 Depth) const -> void {
+        if (&Dst != value) operand().copy_to(&Dst);
+    }
+
+    auto reads(BigDec const *P) const -> bool { return value == P; }
+    auto clobbers([[maybe_unused]] BigDec const *P) const -> bool { return false; }
+};
+
+/**
+ *  \brief  lazy Lhs Op Rhs, built by the operators + - * / on BigDecimal operands and evaluated on assignment.
+ *  \note   evaluation runs in place in the destination along the left operands: a*b + c*d - e copies a into the
+ *          destination, multiplies by b, adds c*d, subtracts e. a right operand that is an expression itself goes
+ *          through one workspace temporary per nesting level (temp_expr), no BigDecimal is created per operator.
+ *          nesting deeper than EXPR_TEMPORARIES_COUNT spills into a BigDecimal of its own per extra level.
+ *  \note   x + p*q, x - p*q, p*q + c and p*q - c with a leaf q (and leaf c) run as one fma_fractional instead of a multiply and an add.
+ *  \note   operands must be normalized fractionals, as for add_fractional etc. / uses div_fractional's default precision.
+ */
+template <typename T_Alloc, BigDecimal_::ExprOp Op, typename T_Lhs, typename T_Rhs>
+struct BigDecimalExpr {
+    using BigDec = BigDecimal<T_Alloc>;
+    using Workspace = typename BigDec::Workspace;
+    static constexpr bool IS_BIG_DECIMAL_EXPR = true;
+    static constexpr bool IS_LEAF = false;
+    //NOTE(##2026 10 18): x * leaf, can be folded into a surrounding + or - with fma_fractional.
+    static constexpr bool IS_FUSABLE_PRODUCT = Op == BigDecimal_::ExprOp::MUL && T_Rhs::IS_LEAF;
+
+    T_Lhs lhs;
+    T_Rhs rhs;
+
+    //NOTE(##2026 10 18): Body(Temp) with the temporary of nesting level Depth
+    template <typename T_Body>
+    static auto with_temp(Workspace& ws, i32 Depth, T_Body&& Body) -> void {
+        if (Depth < BigDec::EXPR_TEMPORARIES_COUNT) {
+            Body(ws.temp_expr[Depth]);
+        } else {
+            BigDec Spill {};
+            Body(Spill);
+        }
+    }
+
+    static auto apply(BigDec& Dst, BigDec& Operand, Workspace& ws) -> void {
+        using BigDecimal_::ExprOp;
+        if constexpr (Op == ExprOp::ADD) Dst.add_fractional(Operand, ws);
+        if constexpr (Op == ExprOp::SUB) Dst.sub_fractional(Operand, ws);
+        if constexpr (Op == ExprOp::MUL) Dst.mul_fractional(Operand, ws);
+        if constexpr (Op == ExprOp::DIV) Dst.div_fractional(Operand, ws);
+    }
+
+    auto eval_into(BigDec& Dst, Workspace& ws, i32 Depth) const -> void {
+        using BigDecimal_::ExprOp;
+        constexpr bool IS_SUM = Op == ExprOp::ADD || Op == ExprOp::SUB;
+        constexpr bool IS_SUB = Op == ExprOp::SUB;
+
+        if constexpr (IS_SUM && T_Lhs::IS_FUSABLE_PRODUCT && T_Rhs::IS_LEAF && !IS_SUB) {
+            lhs.lhs.eval_into(Dst, ws, Depth);
+            Dst.fma_fractional(lhs.rhs.operand(), rhs.operand(), ws);
+        } else if constexpr (IS_SUM && T_Lhs::IS_FUSABLE_PRODUCT && T_Rhs::IS_LEAF) {
+            //NOTE(##2026 10 18): p*q - c == p*q + (-c). negating the result instead would flip UP and DOWN and turn an exact 0 into -0
+            with_temp(ws, Depth, [&](BigDec& Addend) {
+                rhs.operand().copy_to(&Addend);
+                Addend.neg();
+                lhs.lhs.eval_into(Dst, ws, Depth + 1);
+                Dst.fma_fractional(lhs.rhs.operand(), Addend, ws);
+            });
+        } else if constexpr (IS_SUM && T_Rhs::IS_FUSABLE_PRODUCT) {
+            //NOTE(##2026 10 18): x - p*q == (-p)*q + x, computed in the temporary that p*q would have taken anyway
+            lhs.eval_into(Dst, ws, Depth);
+            with_temp(ws, Depth, [&](BigDec& Temp) {
+                Temp.was_divided_by_zero = false;
+                rhs.lhs.eval_into(Temp, ws, Depth + 1);
+                if constexpr (IS_SUB) Temp.neg();
+                Temp.fma_fractional(rhs.rhs.operand(), Dst, ws);
+                Dst.swap(Temp);
+                Dst.was_divided_by_zero |= Temp.was_divided_by_zero;
+            });
+        } else {
+            eval_operands_into(Dst, ws, Depth);
+        }
+    }
+
+    auto eval_operands_into(BigDec& Dst, Workspace& ws, i32 Depth) const -> void {
+        lhs.eval_into(Dst, ws, Depth);
+        if constexpr (T_Rhs::IS_LEAF) {
+            apply(Dst, rhs.operand(), ws);
+        } else {
+            with_temp(ws, Depth, [&](BigDec& Temp) {
+                Temp.was_divided_by_zero = false;
+                rhs.eval_into(Temp, ws, Depth + 1);
+                apply(Dst, Temp, ws);
+                Dst.was_divided_by_zero |= Temp.was_divided_by_zero;
+            });
+        }
+    }
+
+    auto reads(BigDec const *P) const -> bool { return lhs.reads(P) || rhs.reads(P); }
+
+    //NOTE(##2026 10 18): whether evaluating into P would read P after it was overwritten, i.e. P is a right operand somewhere.
+    auto clobbers(BigDec const *P) const -> bool { return lhs.clobbers(P) || rhs.reads(P); }
+
+    auto assign_to(BigDec& Dst, Workspace& ws) const -> void {
+        if (clobbers(&Dst)) {
+            BigDec& Temp = ws.temp_expr[0];
+            Temp.was_divided_by_zero = false;
+            eval_into(Temp, ws, 1);
+            Dst.swap(Temp);
+            Dst.was_divided_by_zero = Temp.was_divided_by_zero;
+        } else {
+            Dst.was_divided_by_zero = false;
+            eval_into(Dst, ws, 0);
+        }
+    }
+};
+
+namespace BigDecimal_ {
+    template <typename T_Alloc>
+    struct BigDecimalOperand<BigDecimal<T_Alloc>> {
+        static constexpr bool value = true;
+        using Alloc = T_Alloc;
+        static auto wrap(BigDecimal<T_Alloc> const& A) -> BigDecimalRef<T_Alloc> { return {&A}; }
+    };
+
+    template <typename T_Alloc, ExprOp Op, typename T_Lhs, typename T_Rhs>
+    struct BigDecimalOperand<BigDecimalExpr<T_Alloc, Op, T_Lhs, T_Rhs>> {
+        static constexpr bool value = true;
+        using Alloc = T_Alloc;
+        static auto wrap(BigDecimalExpr<T_Alloc, Op, T_Lhs, T_Rhs> const& E) -> BigDecimalExpr<T_Alloc, Op, T_Lhs, T_Rhs> { return E; }
+    };
+
+    //NOTE(##2026 10 18): a leaf only points to its BigDecimal, which a temporary would not outlive in e.g. auto e = a * BigDecimal{2u};
+    //so BigDecimal operands must be lvalues. expressions are held by value and may be temporaries.
+    template <typename T>
+    concept BigDecimalExprOperand = BigDecimalOperand<std::remove_cvref_t<T>>::value
+                                    && (std::is_lvalue_reference_v<T>
+                                        || !std::same_as<std::remove_cvref_t<T>, BigDecimal<typename BigDecimalOperand<std::remove_cvref_t<T>>::Alloc>>);
+
+    template <typename T_Lhs, typename T_Rhs>
+    concept BigDecimalOperands = BigDecimalExprOperand<T_Lhs> && BigDecimalExprOperand<T_Rhs>
+                                 && std::same_as<typename BigDecimalOperand<std::remove_cvref_t<T_Lhs>>::Alloc,
+                                                 typename BigDecimalOperand<std::remove_cvref_t<T_Rhs>>::Alloc>;
+
+    template <ExprOp Op, typename T_Lhs, typename T_Rhs>
+    auto make_expr(T_Lhs&& A, T_Rhs&& B) {
+        using LhsOperand = BigDecimalOperand<std::remove_cvref_t<T_Lhs>>;
+        using RhsOperand = BigDecimalOperand<std::remove_cvref_t<T_Rhs>>;
+        using Lhs = decltype(LhsOperand::wrap(std::forward<T_Lhs>(A)));
+        using Rhs = decltype(RhsOperand::wrap(std::forward<T_Rhs>(B)));
+        return BigDecimalExpr<typename LhsOperand::Alloc, Op, Lhs, Rhs>{LhsOperand::wrap(std::forward<T_Lhs>(A)), RhsOperand::wrap(std::forward<T_Rhs>(B))};
+    }
+}
+
+template <typename T_Lhs, typename T_Rhs> requires BigDecimal_::BigDecimalOperands<T_Lhs, T_Rhs>
+auto operator+(T_Lhs&& A, T_Rhs&& B) { return BigDecimal_::make_expr<BigDecimal_::ExprOp::ADD>(std::forward<T_Lhs>(A), std::forward<T_Rhs>(B)); }
+
+template <typename T_Lhs, typename T_Rhs> requires BigDecimal_::BigDecimalOperands<T_Lhs, T_Rhs>
+auto operator-(T_Lhs&& A, T_Rhs&& B) { return BigDecimal_::make_expr<BigDecimal_::ExprOp::SUB>(std::forward<T_Lhs>(A), std::forward<T_Rhs>(B)); }
+
+template <typename T_Lhs, typename T_Rhs> requires BigDecimal_::BigDecimalOperands<T_Lhs, T_Rhs>
+auto operator*(T_Lhs&& A, T_Rhs&& B) { return BigDecimal_::make_expr<BigDecimal_::ExprOp::MUL>(std::forward<T_Lhs>(A), std::forward<T_Rhs>(B)); }
+
+template <typename T_Lhs, typename T_Rhs> requires BigDecimal_::BigDecimalOperands<T_Lhs, T_Rhs>
+auto operator/(T_Lhs&& A, T_Rhs&& B) { return BigDecimal_::make_expr<BigDecimal_::ExprOp::DIV>(std::forward<T_Lhs>(A), std::forward<T_Rhs>(B)); }
+
+
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::neg () -> void {
     this->is_negative = !this->is_negative;
@@ -1768,7 +4445,7 @@ auto BigDecimal<T_Alloc>::neg () -> void {
  *            and more explicit and clear to say A.zero(ZERO_EVERYTHING) than A.set(0)*/
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::zero(flags32 what) -> void {
-        data.value = 0x0;
+        chunks[0] = 0x0;
         length = 1;
     if (IsSet(what, ZERO_SIGN))
         is_negative = false;
@@ -1778,13 +4455,13 @@ auto BigDecimal<T_Alloc>::zero(flags32 what) -> void {
 
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::set_bits_64(u64 value) -> void {
-    i32 n_src_bits = BitScanReverse<u64>(value) + 1;
+    i32 n_src_bits = std::bit_width(value);
     if (n_src_bits == 0) n_src_bits = 1;
     i32 n_src_bytes = DivCeil(n_src_bits, 8);
     i32 n_chunk_bytes = sizeof(ChunkBits);
 
     length = 1;
-    ChunkList *chunk = &data;
+    ChunkBits *chunk = chunks;
 
     i32 n_grab_bytes = n_src_bytes <= n_chunk_bytes ? n_src_bytes : n_chunk_bytes;
     i32 n_grab_bits = n_grab_bytes * 8;
@@ -1792,7 +4469,7 @@ auto BigDecimal<T_Alloc>::set_bits_64(u64 value) -> void {
 
     i32 offset = 0;
     u64 mask = GetMaskBottomN<u64>(n_grab_bits);
-    chunk->value = value & mask;
+    *chunk = value & mask;
 
     for ( ; n_bytes_remaining > 0 ; n_bytes_remaining -= n_grab_bytes ) {
         offset += n_grab_bits;
@@ -1804,7 +4481,7 @@ auto BigDecimal<T_Alloc>::set_bits_64(u64 value) -> void {
         mask <<= offset;
         chunk = extend_length();
         HardAssert(offset < 64 && offset >=0);
-        chunk->value = (value & mask) >> offset;
+        *chunk = (value & mask) >> offset;
     }
 
     HardAssert(this->is_normalized_integer());
@@ -1845,18 +4522,12 @@ auto BigDecimal<T_Alloc>::set_bits_array(T_Slot *vals, u32 count) -> void {
 
     i32 chunks_total = (bytes_total + chunk_bytes - 1) / chunk_bytes;
 
-    length = 1;
-    while (length < chunks_total) {
-        extend_length();
-    }
+    reserve_limbs(chunks_total);
+    length = chunks_total;
 
-    ChunkList *chunk = &data;
-    for (i32 i = 0; i < length ; ++i) {
-        chunk->value = 0;
-        chunk = chunk->next;
-    }
+    BigDecimal_::zero_chunks(chunks, length);
 
-    chunk = &data;
+    ChunkBits *chunk = chunks;
     T_Slot *slot = vals;
     i32 chunk_bits = chunk_bytes * 8;
     if (chunks_per_slot) {
@@ -1871,11 +4542,11 @@ auto BigDecimal<T_Alloc>::set_bits_array(T_Slot *vals, u32 count) -> void {
             for(i32 chunk_idx = 0 ; chunk_idx < chunks_per_slot ; ++chunk_idx) {
                 T_Slot chunk_val = *slot & mask;
                 chunk_val >>= offset;
-                chunk->value = chunk_val;
+                *chunk = chunk_val;
 
                 mask <<= chunk_bits;
                 offset += chunk_bits;
-                chunk = chunk->next;
+                ++chunk;
             }
             ++slot;
         }
@@ -1885,11 +4556,11 @@ auto BigDecimal<T_Alloc>::set_bits_array(T_Slot *vals, u32 count) -> void {
         for(i32 chunk_idx = 0 ; chunk_idx < top_chunks ; ++chunk_idx) {
             T_Slot chunk_val = *slot & mask;
             chunk_val >>= offset;
-            chunk->value = chunk_val;
+            *chunk = chunk_val;
 
             mask <<= chunk_bits;
             offset += chunk_bits;
-            chunk = chunk->next;
+            ++chunk;
         }
     } else {
         i32 slot_bits = slot_bytes * 8;
@@ -1908,8 +4579,8 @@ auto BigDecimal<T_Alloc>::set_bits_array(T_Slot *vals, u32 count) -> void {
                 offset += slot_bits;
                 ++slot;
             }
-            chunk->value = chunk_val;
-            chunk = chunk->next;
+            *chunk = chunk_val;
+            ++chunk;
         }
         i32 slots_left = slots_total - slots_per_chunk * (length-1);
         chunk_val = 0x0;
@@ -1922,8 +4593,8 @@ auto BigDecimal<T_Alloc>::set_bits_array(T_Slot *vals, u32 count) -> void {
             offset += slot_bits;
             ++slot;
         }
-        chunk->value = chunk_val;
-        chunk = chunk->next;
+        *chunk = chunk_val;
+        ++chunk;
     }
 
     HardAssert(this->is_normalized_integer());
@@ -1963,38 +4634,22 @@ auto BigDecimal<T_Alloc>::set(T_Slot *ValArray, u32 ValCount, bool is_negative/*
 
 
 //TODO(##2024 07 04):Support NAN (e=128, mantissa != 0)
+//NOTE(##2026 10 18): at most 53 significant bits, they go straight into chunks[0] without normalize()
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::set_float(real32 Val) -> void {
-    this->zero();
-    this->is_negative = Sign(Val);
-    this->exponent = Exponent32(Val);
-    bool Denormalized = IsDenormalized(Val);
-    u32 Mantissa = Mantissa32(Val, !Denormalized);
-    i32 mantissa_bitcount = BitScanReverse32(Mantissa) + 1;
-    if (Denormalized && Mantissa != 0) {
-        exponent -= 22-BitScanReverse32(Mantissa);
-    }
-
-    u32 chunk_width = CHUNK_WIDTH;
-    set_bits_64(Mantissa);
-    this->normalize(); //NOTE(ArokhSlade##2024 10 18): truncate trailing zeros
+    u32 Bits = std::bit_cast<u32>(Val);
+    chunks[0] = BigDecimal_::float_bits_to_chunk(Bits, FLOAT_PRECISION, 8, &exponent);
+    length = 1;
+    is_negative = (Bits >> 31) != 0;
 }
 
 //TODO(##2024 07 04):Support NAN (e=128, mantissa != 0)
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::set_double(f64 Val) -> void {
-
-    this->zero();
-    this->is_negative = Sign(Val);
-    this->exponent = Exponent64(Val);
-    bool Denormalized = IsDenormalized(Val);
-    u64 Mantissa = Mantissa64(Val, !Denormalized);
-    i32 mantissa_bitcount = BitScanReverse<u64>(Mantissa) + 1;
-    if (Denormalized && Mantissa != 0) {
-        exponent -= DOUBLE_PRECISION-2-BitScanReverse<u64>(Mantissa);
-    }
-    set_bits_64(Mantissa);
-    this->normalize();
+    u64 Bits = std::bit_cast<u64>(Val);
+    chunks[0] = BigDecimal_::float_bits_to_chunk(Bits, DOUBLE_PRECISION, 11, &exponent);
+    length = 1;
+    is_negative = (Bits >> 63) != 0;
 }
 
 template <typename T_Alloc>
@@ -2006,16 +4661,11 @@ auto BigDecimal<T_Alloc>::initialize_context (const T_Alloc& ctx_alloc) -> void
     BigDec::s_chunk_alloc = ChunkAlloc{ctx_alloc};
     BigDec::s_link_alloc = LinkAlloc{BigDec::s_chunk_alloc};
 
-    for (i32 i = 0 ;  i < TEMPORARIES_COUNT ; ++i) {
-//        new(s_all_temporaries_ptrs[i]) BigDec{SpecialConstants::BELONGS_TO_CONTEXT, s_chunk_alloc};
-        s_all_temporaries_ptrs[i]->initialize(s_chunk_alloc);
-    }
-
-    temp_one.set(1);
-    temp_ten.set(10);
-    temp_pow_10.set(1);
-    temp_parse_frac.set(1);
     BigDecimal<T_Alloc>::s_is_context_initialized = true;
+
+    //NOTE(##2026 10 18): the initializing thread's workspace is created right away, so its temporaries are
+    //the TEMPORARIES_COUNT context variables expected by close_context().
+    workspace();
 }
 
 
@@ -2037,25 +4687,25 @@ auto BigDecimal<T_Alloc>::copy_bits_to(T_Slot *slots, i32 slot_count) -> void {
     i32 chunks_per_slot = bits_per_slot / bits_per_chunk;
     i32 slots_per_chunk = bits_per_chunk / bits_per_slot;
 
-    ChunkList *chunk = &data;
+    ChunkBits *chunk = chunks;
     T_Slot *slot = slots;
     if (chunks_per_slot) {
         i32 chunk_idx = 0;
         i32 offset = 0;
         for (  ; chunk_idx  + chunks_per_slot <= length ; chunk_idx  += chunks_per_slot ) {
             for ( i32 slot_idx = 0 ; slot_idx < chunks_per_slot ; ++slot_idx ) {
-                *slot |= (T_Slot)chunk->value << offset;
+                *slot |= (T_Slot)*chunk << offset;
                 offset += bits_per_chunk;
-                chunk = chunk->next;
+                ++chunk;
             }
             offset = 0;
             ++slot;
         }
         //handle remainder
         for ( ; chunk_idx < length ; ++chunk_idx ) {
-            *slot |= (T_Slot)chunk->value << offset;
+            *slot |= (T_Slot)*chunk << offset;
             offset += bits_per_chunk;
-            chunk = chunk->next;
+            ++chunk;
 
         }
     } else { //chunks are bigger than slots
@@ -2067,7 +4717,7 @@ auto BigDecimal<T_Alloc>::copy_bits_to(T_Slot *slots, i32 slot_count) -> void {
             HardAssert(total_slot_idx < slot_count);
             i32 offset = 0;
             for ( i32 slot_idx = 0 ; slot_idx < slots_per_chunk ; ++slot_idx) {
-                ChunkBits piece = chunk->value & chunk_mask;
+                ChunkBits piece = *chunk & chunk_mask;
                 piece >>= offset; //NOTE(ArokhSlade ## 2024 10 06): offset < bit width b/c chunks_per_slot==0
                 *slot = piece;
                 chunk_mask <<= bits_per_slot;
@@ -2077,14 +4727,14 @@ auto BigDecimal<T_Alloc>::copy_bits_to(T_Slot *slots, i32 slot_count) -> void {
                 }
                 offset += bits_per_slot;
             }
-            chunk = chunk->next;
+            ++chunk;
         }
     }
 
     return;
 }
 
-//TODO(##2024 07 04): are there faster ways to compute the mantissa than calling Round()?
+/** \brief  the nearest f32, round-to-even, reads only the top chunks of this, see BigDecimal_::round_to_float_bits */
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::to_float() -> f32 {
 
@@ -2092,74 +4742,12 @@ auto BigDecimal<T_Alloc>::to_float() -> f32 {
         return 0.f;
     }
 
-    this->copy_to(&BigDecimal::temp_to_float);
-    bool Sign = temp_to_float.is_negative;
-
-    int MantissaBitCount = 24;
-
-    i32 Resultexponent = temp_to_float.exponent;
-
-    if (Resultexponent < -150) {
-        return Sign ? -0.f : 0.f;
-    }
-
-    if (Resultexponent < -126) {
-        MantissaBitCount = 150+Resultexponent;
-    }
-
-    temp_to_float.round_to_n_significant_bits(MantissaBitCount); //exponent may change
-
-    Resultexponent = temp_to_float.exponent;
-
-    if (temp_to_float.is_zero()) {
-        return Sign ? -0.f : 0.f;
-    }
-    if (Resultexponent > 127)
-    {
-        return Sign ? -Inf32 : Inf32;
-    }
-
-    bool Denormalized = Resultexponent < -126;
-
-    if (Denormalized) {
-        MantissaBitCount = 150+Resultexponent; //new exponent => new MSB for Denormalized
-    }
-    HardAssert(MantissaBitCount >= 1 && MantissaBitCount <= 24);
-
-    u32 MantissaMask = MantissaBitCount == 24 ? GetMaskBottomN<u32>(23) : //Normalized: 1st Bit implicit
-                                    GetMaskBottomN<u32>(MantissaBitCount); //Denormalized: all Bits explicit
-
-
-
-
-    i32 chunks_required = (FLOAT_PRECISION + CHUNK_WIDTH - 1) / CHUNK_WIDTH;
-    HardAssert(temp_to_float.length <= chunks_required);
-
-    i32 BitCount = temp_to_float.count_bits(); //NOTE(ArokhSlade##2024 09 25): after rounding, value is normalized, i.e. trailing zeroes are chopped off.
-    HardAssert (MantissaBitCount >= BitCount);
-    i32 ShiftAmount = MantissaBitCount - BitCount; //NOTE(ArokhSlade##2024 09 25): reintroduce trailing zeroes
-
-    u32 Mantissa = 0;
-    temp_to_float.shift_left(ShiftAmount);
-    temp_to_float.copy_bits_to(&Mantissa, 1);
-    Mantissa &= MantissaMask;
-
-    // IEEE-754 float32 format
-    //sign|exponent|        mantissa
-    //   _|________|__________,__________,___
-    //   1|<---8-->|<---------23------------>
-
-    u32 Result = Sign << 31;
-    u32 Bias = 127;
-    Resultexponent = Denormalized || this->is_zero() ? 0 : Resultexponent + Bias;
-    Result |= Resultexponent << 23;
-    Result |= Mantissa;
-
-    return *reinterpret_cast<float *>(&Result);
+    u32 Result = static_cast<u32>(BigDecimal_::round_to_float_bits(chunks, length, exponent, is_negative, FLOAT_PRECISION, 8));
+    return std::bit_cast<f32>(Result);
 }
 
 
-//TODO(##2024 10 18): (copied from to_float) are there faster ways to compute the mantissa than calling Round()?
+/** \brief  the nearest f64, round-to-even, reads only the top chunks of this, see BigDecimal_::round_to_float_bits */
 template <typename T_Alloc>
 auto BigDecimal<T_Alloc>::to_double() -> f64 {
 
@@ -2167,72 +4755,8 @@ auto BigDecimal<T_Alloc>::to_double() -> f64 {
         return 0.f;
     }
 
-    this->copy_to(&BigDecimal::temp_to_float);
-    bool Sign = temp_to_float.is_negative;
-
-    int MantissaBitCount = DOUBLE_PRECISION;
-
-    i64 ResultExponent = temp_to_float.exponent;
-
-    if (ResultExponent < MinExponent64) {
-        return Sign ? -0.f : 0.f;
-    }
-
-    if (ResultExponent < -(FloatBias64-1)) {
-        MantissaBitCount = (-MinExponent64)+ResultExponent;
-    }
-
-    temp_to_float.round_to_n_significant_bits(MantissaBitCount); //exponent may change
-
-    ResultExponent = temp_to_float.exponent;
-
-    if (ResultExponent < (MinExponent64+1) /*|| temp_to_float.is_zero()*/) { //TODO(##2024 07 13):check is_zero?
-        return Sign ? -0.f : 0.f;
-    }
-    if (ResultExponent > FloatBias64)
-    {
-        return Sign ? -Inf64 : Inf64;
-    }
-
-    bool Denormalized = ResultExponent < -(FloatBias64-1); //TODO(ArokhSlade##2024 10 18): simplify with <=
-
-    if (Denormalized) {
-        MantissaBitCount = (-MinExponent64)+ResultExponent; //new exponent => new MSB for Denormalized
-    }
-    HardAssert(MantissaBitCount >= 1 && MantissaBitCount <= DOUBLE_PRECISION);
-    //TODO(ArokhSlade##2024 09 30): use the new MaskBottomNBits function
-    u64 MantissaMask = MantissaBitCount == DOUBLE_PRECISION ? GetMaskBottomN<u64>(DOUBLE_PRECISION-1) : //Normalized: 1st Bit implicit
-                                    GetMaskBottomN<u64>(MantissaBitCount); //Denormalized: all Bits explicit
-
-
-
-
-    i32 chunks_required = (DOUBLE_PRECISION + CHUNK_WIDTH - 1) / CHUNK_WIDTH;
-    HardAssert(temp_to_float.length <= chunks_required);
-
-    i32 BitCount = temp_to_float.count_bits(); //NOTE(ArokhSlade##2024 09 25): after rounding, value is normalized, i.e. trailing zeroes are chopped off.
-    HardAssert (MantissaBitCount >= BitCount);
-    i32 ShiftAmount = MantissaBitCount - BitCount; //NOTE(ArokhSlade##2024 09 25): reintroduce trailing zeroes
-
-    u64 Mantissa = 0;
-
-    temp_to_float.shift_left(ShiftAmount);
-    temp_to_float.copy_bits_to(&Mantissa, 1);
-    Mantissa &= MantissaMask;
-
-    // IEEE-754 float64 format
-    //sign|  exponent  |                      mantissa
-    //   _|_______,____|____,________,________,________,________,________,________
-    //   1|<----11---->|<------------------------52------------------------------>
-
-    u64 ResultBits = (u64)Sign << 63;
-    u64 Bias = FloatBias64;
-    ResultExponent = Denormalized || this->is_zero() ? 0 : ResultExponent + Bias;
-    ResultExponent <<= DOUBLE_PRECISION-1;
-    ResultBits |= ResultExponent;
-    ResultBits |= Mantissa;
-    f64 Result = *reinterpret_cast<f64 *>(&ResultBits);
-    return Result;
+    u64 Result = BigDecimal_::round_to_float_bits(chunks, length, exponent, is_negative, DOUBLE_PRECISION, 11);
+    return std::bit_cast<f64>(Result);
 }
 
 typedef BigDecimal<std::allocator<ChunkBits>> Big_Dec_Std;
@@ -2245,16 +4769,16 @@ BigDecimal<T_Alloc>::operator std::string(){
     std::string Result;
 
     Result += is_negative ? '-' : '+';
-    ChunkList *Cur = get_head();
+    ChunkBits *Cur = get_head();
     i32 UnusedChunks = m_chunks_capacity - length;
     constexpr i32 width = sizeof(ChunkBits) * 2;
-    char HexDigits[width+1] = "";
+    char HexDigits[width+2] = ""; //NOTE(##2026 10 18): digits + ' ' + '\0'
 
 //    i32 UnusedChunksFieldSize = 2 + ( UnusedChunks > 1 ? UnusedChunks : 1);
 //    i32 BufSize = 1+length*9+2+UnusedChunksFieldSize+1;
 
-    for (i32 Idx = 0 ; Idx < length; ++Idx, Cur = Cur->prev) {
-        stbsp_sprintf(HexDigits, "%.*llx ", width, Cur->value);
+    for (i32 Idx = 0 ; Idx < length; ++Idx, --Cur) {
+        stbsp_sprintf(HexDigits, "%.*llx ", width, *Cur);
         Result += HexDigits;
     }
 
@@ -2281,7 +4805,7 @@ std::ostream& operator<<(std::ostream& Out, BigDecimal<T_Alloc>& big_decimal) {
 template <typename T_ChunkBitsAlloc, typename T_CharAlloc>
 auto to_chars(BigDecimal<T_ChunkBitsAlloc>& A, T_CharAlloc& string_alloc) -> char* {
     char Sign = A.is_negative ? '-' : '+';
-    typename BigDecimal<T_ChunkBitsAlloc>::ChunkList *CurChunk = A.get_head();
+    ChunkBits *CurChunk = A.get_head();
     i32 UnusedChunks = A.m_chunks_capacity - A.length;
     char HexDigits[11] = "";
 
@@ -2294,8 +4818,8 @@ auto to_chars(BigDecimal<T_ChunkBitsAlloc>& A, T_CharAlloc& string_alloc) -> cha
     char *BufPos=Buf;
     *BufPos++ = Sign;
 
-    for (i32 Idx = 0 ; Idx < A.length; ++Idx, CurChunk = CurChunk->prev) {
-        stbsp_sprintf(BufPos, "%.8x ", CurChunk->value);
+    for (i32 Idx = 0 ; Idx < A.length; ++Idx, --CurChunk) {
+        stbsp_sprintf(BufPos, "%.8x ", *CurChunk);
         BufPos +=9;
     }
 
@@ -2308,6 +4832,413 @@ auto to_chars(BigDecimal<T_ChunkBitsAlloc>& A, T_CharAlloc& string_alloc) -> cha
 }
 
 
+/**
+ *  \brief  writes A as decimal string into a buffer from char_alloc, the caller owns it.
+ *  \arg    Format FIXED      : digits after the point = Precision, rounded half to even. negative Precision: all digits, exact.
+ *                              no sign if all digits are 0.
+ *  \arg    Format SCIENTIFIC : d.ddde+XX with Precision digits after the point, rounded half to even. negative Precision: all digits, exact.
+ *  \arg    Format SHORTEST   : fewest digits that round back to A at Precision significant bits.
+ *                              negative Precision: A.count_bits(), but at least CHUNK_WIDTH.
+ *                              if A has more bits than that, A is rounded first, i.e. Precision 53 prints A as the double it is closest to.
+ *                              fixed layout for decimal exponents -7 < e < 21, scientific otherwise.
+ *  \note   conversion to decimal is divide and conquer by the cached powers of ten, see BigDecimal_::radix_thresholds.
+ */
+template <typename T_ChunkBitsAlloc, typename T_CharAlloc>
+auto to_decimal_chars(BigDecimal<T_ChunkBitsAlloc>& A, T_CharAlloc& char_alloc,
+                      BigDecimal_::DecimalFormat Format = BigDecimal_::DecimalFormat::SHORTEST, i32 Precision = -1) -> char* {
+    using BigDec = BigDecimal<T_ChunkBitsAlloc>;
+    using BigDecimal_::DecimalFormat;
+
+    typename BigDec::Workspace& ws = BigDec::workspace();
+    BigDec& Value = ws.temp_dec_value;
+    A.copy_to(&Value);
+    Value.is_negative = false;
+    Value.normalize();
+
+    bool IsZero = Value.is_zero();
+    bool Negative = A.is_negative && !IsZero;
+    i32 FracBits = IsZero ? 0 : Value.get_msb() - Value.exponent;
+    i32 Exact = FracBits > 0 ? FracBits : 0; //NOTE(##2026 10 18): 10^k * A is an integer for k >= the number of bits after the point
+
+    i32 Scale = 0; // temp_dec_int = A * 10^Scale
+    if (IsZero) {
+        ws.temp_dec_int.zero();
+        Scale = Format == DecimalFormat::FIXED && Precision > 0 ? Precision : 0;
+    } else if (Format == DecimalFormat::FIXED) {
+        Scale = Precision >= 0 ? Precision : Exact;
+        BigDec::decimal_round(Scale);
+    } else if (Format == DecimalFormat::SCIENTIFIC) {
+        Scale = Precision >= 0 ? Precision - BigDec::decimal_exponent() : Exact;
+        BigDec::decimal_round(Scale);
+    } else {
+        i32 Bits = Precision > 0 ? Precision : Value.count_bits() > CHUNK_WIDTH ? Value.count_bits() : CHUNK_WIDTH;
+        if (Value.count_bits() > Bits) Value.round_to_n_significant_bits(Bits, ws);
+        Scale = BigDec::decimal_shortest(Bits);
+    }
+
+    i32 DigitCount = BigDec::to_decimal_chunks(ws.temp_dec_int);
+    ChunkBits const *Dec = ws.temp_dec_digits.chunks;
+    i32 Exponent10 = IsZero ? 0 : DigitCount - 1 - Scale; // of the leading digit
+
+    i32 Significant = DigitCount;
+    while (Significant > 1 && BigDecimal_::decimal_chunks_digit(Dec, DigitCount - Significant) == '0') --Significant;
+    //NOTE(##2026 10 18): FIXED can round a small negative value to zero digits, it prints as 0.00 then, not -0.00
+    if (Significant == 1 && BigDecimal_::decimal_chunks_digit(Dec, DigitCount - 1) == '0') Negative = false;
+
+    bool Fixed = Format == DecimalFormat::FIXED;
+    i32 FracDigits = Scale;
+    i32 MantissaDigits = Significant;
+    if (Format == DecimalFormat::SCIENTIFIC && Precision >= 0) {
+        MantissaDigits = Precision + 1;
+    }
+    if (Format == DecimalFormat::SHORTEST) {
+        Fixed = -7 < Exponent10 && Exponent10 < 21;
+        FracDigits = Significant - 1 - Exponent10 > 0 ? Significant - 1 - Exponent10 : 0;
+    }
+
+    // Idx counts from the leading digit, beyond the digits there are only zeros
+    auto Digit = [&](i32 Idx) -> char {
+        if (Idx < 0 || Idx >= DigitCount) return '0';
+        return BigDecimal_::decimal_chunks_digit(Dec, DigitCount - 1 - Idx);
+    };
+
+    // run once to measure, once to write
+    auto Write = [&](char *Out) -> i32 {
+        i32 Len = 0;
+        auto Put = [&](char C) {
+            if (Out) Out[Len] = C;
+            ++Len;
+        };
+
+        if (Negative) Put('-');
+        if (Fixed) {
+            for (i32 Pos = Exponent10 > 0 ? Exponent10 : 0 ; Pos >= 0 ; --Pos) Put(Digit(Exponent10 - Pos));
+            if (FracDigits > 0) Put('.');
+            for (i32 Pos = -1 ; Pos >= -FracDigits ; --Pos) Put(Digit(Exponent10 - Pos));
+        } else {
+            Put(Digit(0));
+            if (MantissaDigits > 1) Put('.');
+            for (i32 Idx = 1 ; Idx < MantissaDigits ; ++Idx) Put(Digit(Idx));
+            Put('e');
+            Put(Exponent10 < 0 ? '-' : '+');
+            i32 AbsExponent = Exponent10 < 0 ? -Exponent10 : Exponent10;
+            char ExpDigits[12] = "";
+            i32 ExpLen = 0;
+            do {
+                ExpDigits[ExpLen++] = static_cast<char>('0' + AbsExponent % 10);
+                AbsExponent /= 10;
+            } while (AbsExponent || ExpLen < 2);
+            while (ExpLen) Put(ExpDigits[--ExpLen]);
+        }
+        return Len;
+    };
+
+    i32 BufSize = Write(nullptr) + 1;
+    char *Buf = std::allocator_traits<T_CharAlloc>::allocate(char_alloc, BufSize);
+    Write(Buf);
+    Buf[BufSize-1] = '\0';
+
+    return Buf;
+}
+
+
+/**
+ *  \brief  BigDecimal with a compile-time precision of Bits significant bits. the chunks live inline in a std::array,
+ *          nothing is ever allocated and no context or workspace is needed.
+ *  \note   same value layout as a normalized fractional BigDecimal: the chunks hold the significant bits as an integer
+ *          with its lowest 1 at bit 0, exponent is the exponent of the leading 1, the sign is kept separately.
+ *          the chunks above the value are zero. zero is all chunks 0, exponent 0, positive.
+ *  \note   every result is rounded to Bits significant bits, round-to-even. operands are never rounded twice:
+ *          add, sub, mul and div first compute enough exact bits plus a sticky bit in a buffer on the stack.
+ *  \note   the loops run over CHUNKS_COUNT and WIDE_CHUNKS_COUNT, which are compile-time constants, so they can be unrolled.
+ */
+template <i32 Bits>
+struct FixedBigDecimal {
+    static_assert(Bits > 0);
+
+    static constexpr i32 BITS = Bits;
+    static constexpr i32 CHUNKS_COUNT = (Bits + CHUNK_WIDTH - 1) / CHUNK_WIDTH;
+    static constexpr i32 WIDE_CHUNKS_COUNT = 2 * CHUNKS_COUNT + 1; //NOTE(##2026 10 18): products, aligned sums and shifted dividends
+
+    std::array<ChunkBits, CHUNKS_COUNT> chunks {};
+    i32 exponent = 0;
+    bool is_negative = false;
+    bool was_divided_by_zero = false;
+
+    FixedBigDecimal() = default;
+
+    template <std::integral T_Src>
+    FixedBigDecimal(T_Src Value) { set_integer(Value); }
+
+    FixedBigDecimal(f64 Value) { set_double(Value); }
+
+    template <typename T_Alloc>
+    explicit FixedBigDecimal(BigDecimal<T_Alloc>& Src) { set(Src); }
+
+    auto is_zero() const -> bool {
+        for (i32 Idx = 0 ; Idx < CHUNKS_COUNT ; ++Idx) {
+            if (chunks[Idx] != 0x0) return false;
+        }
+        return true;
+    }
+
+    auto is_normalized_fractional() const -> bool { return is_zero() || (chunks[0] & 0x1); }
+
+    /** \return index of the leading 1 (lsb 0 numbering) for non-zero values, 0 otherwise. */
+    auto get_msb() const -> i32 {
+        for (i32 Idx = CHUNKS_COUNT-1 ; Idx >= 0 ; --Idx) {
+            if (chunks[Idx] != 0x0) return Idx * CHUNK_WIDTH + CHUNK_WIDTH - 1 - static_cast<i32>(BigDecimal_::leading_zeros(chunks[Idx]));
+        }
+        return 0;
+    }
+
+    auto count_bits() const -> i32 { return get_msb() + 1; }
+
+    auto get_least_significant_exponent() const -> i32 { return exponent - get_msb(); }
+
+    auto neg() -> FixedBigDecimal& { if (!is_zero()) is_negative = !is_negative; return *this; }
+
+    auto zero() -> FixedBigDecimal& {
+        chunks = {};
+        exponent = 0;
+        is_negative = false;
+        return *this;
+    }
+
+    auto equals_fractional(FixedBigDecimal const& B) const -> bool {
+        return chunks == B.chunks && exponent == B.exponent && is_negative == B.is_negative;
+    }
+
+    /** \brief same order as BigDecimal::compare_fractional, zero is always positive here. */
+    auto compare_fractional(FixedBigDecimal const& B) const -> std::strong_ordering {
+        bool ZeroA = is_zero(), ZeroB = B.is_zero();
+        if (ZeroA || ZeroB) {
+            if (ZeroA && ZeroB) return std::strong_ordering::equal;
+            bool NegativeSide = ZeroA ? !B.is_negative : is_negative;
+            return NegativeSide ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        if (is_negative != B.is_negative) return is_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+        i32 Magnitude = exponent != B.exponent ? (exponent < B.exponent ? -1 : 1)
+                      : BigDecimal_::compare_chunks_from_top(chunks.data(), BigDecimal_::significant_chunks(chunks.data(), CHUNKS_COUNT),
+                                                             B.chunks.data(), BigDecimal_::significant_chunks(B.chunks.data(), CHUNKS_COUNT));
+        if (is_negative) Magnitude = -Magnitude;
+        return Magnitude <=> 0;
+    }
+
+    /** \brief  the integer value, e.g. 3 becomes 1.1b E1 (unlike BigDecimal::set, which takes the bits as they are). */
+    template <std::integral T_Src>
+    auto set_integer(T_Src Value) -> FixedBigDecimal& {
+        bool Negative = false;
+        u64 Magnitude = static_cast<u64>(Value);
+        if constexpr (std::is_signed_v<T_Src>) {
+            Negative = Value < 0;
+            if (Negative) Magnitude = 0 - Magnitude;
+        }
+        ChunkBits Src[1] = {Magnitude};
+        return set_rounded(Src, 1, 0, Negative);
+    }
+
+    /** \note   decodes through float_bits_to_chunk, as BigDecimal::set_double does: an infinity becomes +-2^1024 and a NaN a value
+     *          of at least 2^1024, both of which to_double() turns into an infinity of the same sign. -0.0 becomes zero.
+     */
+    auto set_double(f64 Value) -> FixedBigDecimal& {
+        u64 DoubleBits = std::bit_cast<u64>(Value);
+        i32 Exponent2 = 0;
+        ChunkBits Src[1] = {BigDecimal_::float_bits_to_chunk(DoubleBits, DOUBLE_PRECISION, 11, &Exponent2)};
+        if (Src[0] == 0x0) return zero();
+        i32 Msb = CHUNK_WIDTH - 1 - static_cast<i32>(BigDecimal_::leading_zeros(Src[0]));
+        return set_rounded(Src, 1, Exponent2 - Msb, (DoubleBits >> 63) != 0);
+    }
+
+    /** \note   Src must be a fractional. it is rounded if it has more than Bits significant bits. */
+    template <typename T_Alloc>
+    auto set(BigDecimal<T_Alloc>& Src) -> FixedBigDecimal& {
+        HardAssert(Src.is_fractional());
+        if (Src.is_zero()) return zero();
+        return set_rounded(Src.chunks, Src.length, Src.get_least_significant_exponent(), Src.is_negative);
+    }
+
+    template <typename T_Alloc>
+    auto copy_to(BigDecimal<T_Alloc> *Dst) const -> void {
+        HardAssert(Dst != nullptr);
+        Dst->reserve_limbs(CHUNKS_COUNT);
+        BigDecimal_::copy_chunks(Dst->chunks, chunks.data(), CHUNKS_COUNT);
+        Dst->length = BigDecimal_::significant_chunks(chunks.data(), CHUNKS_COUNT);
+        Dst->exponent = exponent;
+        Dst->is_negative = is_negative;
+    }
+
+    /** \brief  this = (-1)^Negative * W[0..Count) * 2^LSE, rounded to Precision significant bits, round-to-even.
+     *  \note   Sticky means the exact value has more 1 bits below W[0]. then W must have at least Precision+2 significant bits.
+     */
+    auto set_rounded(ChunkBits const *W, i32 Count, i32 LSE, bool Negative, bool Sticky = false, i32 Precision = Bits) -> FixedBigDecimal& {
+        HardAssert(0 < Precision && Precision <= Bits);
+        Count = BigDecimal_::significant_chunks(W, Count);
+        if (Count == 1 && W[0] == 0x0) {
+            HardAssert(!Sticky);
+            return zero();
+        }
+
+        i32 Msb = Count * CHUNK_WIDTH - 1 - static_cast<i32>(BigDecimal_::leading_zeros(W[Count-1]));
+        i32 Drop = Msb + 1 - Precision;
+
+        ChunkBits M[CHUNKS_COUNT + 1] = {};
+        if (Drop <= 0) {
+            HardAssert(!Sticky);
+            Drop = 0;
+            BigDecimal_::copy_chunks(M, W, Count);
+        } else {
+            HardAssert(!Sticky || Drop >= 2);
+            i32 GuardIdx = Drop - 1;
+            bool Guard = (W[GuardIdx / CHUNK_WIDTH] >> (GuardIdx % CHUNK_WIDTH)) & 0x1;
+            bool Rest = Sticky || (W[GuardIdx / CHUNK_WIDTH] & GetMaskBottomN<ChunkBits>(GuardIdx % CHUNK_WIDTH));
+            for (i32 Idx = 0 ; !Rest && Idx < GuardIdx / CHUNK_WIDTH ; ++Idx) Rest = W[Idx] != 0x0;
+
+            i32 DropChunks = Drop / CHUNK_WIDTH;
+            BigDecimal_::shift_right_chunks(M, W + DropChunks, Count - DropChunks, Drop % CHUNK_WIDTH);
+
+            if (Guard && (Rest || (M[0] & 0x1))) {
+                BigDecimal_::add_chunk(M, M, CHUNKS_COUNT + 1, 1); //NOTE(##2026 10 18): may carry into bit Precision, the trailing zeros go below
+            }
+        }
+
+        i32 MsbM = 0;
+        for (i32 Idx = CHUNKS_COUNT ; Idx >= 0 ; --Idx) {
+            if (M[Idx] != 0x0) { MsbM = Idx * CHUNK_WIDTH + CHUNK_WIDTH - 1 - static_cast<i32>(BigDecimal_::leading_zeros(M[Idx])); break; }
+        }
+        exponent = LSE + Drop + MsbM;
+        is_negative = Negative;
+
+        i32 ZeroChunks = 0;
+        while (M[ZeroChunks] == 0x0) ++ZeroChunks;
+        u32 TrailingZeros = BigDecimal_::trailing_zeros(M[ZeroChunks]);
+        BigDecimal_::shift_right_chunks(M, M + ZeroChunks, CHUNKS_COUNT + 1 - ZeroChunks, TrailingZeros);
+        BigDecimal_::zero_chunks(M + CHUNKS_COUNT + 1 - ZeroChunks, ZeroChunks);
+        HardAssert(M[CHUNKS_COUNT] == 0x0);
+        BigDecimal_::copy_chunks(chunks.data(), M, CHUNKS_COUNT);
+
+        return *this;
+    }
+
+    auto add_fractional(FixedBigDecimal const& B) -> FixedBigDecimal& { return add_signed(B, B.is_negative); }
+    auto sub_fractional(FixedBigDecimal const& B) -> FixedBigDecimal& { return add_signed(B, !B.is_negative); }
+
+    auto mul_fractional(FixedBigDecimal const& B) -> FixedBigDecimal& {
+        if (is_zero() || B.is_zero()) return zero();
+        ChunkBits W[2 * CHUNKS_COUNT];
+        BigDecimal_::mul_chunks_basecase(W, chunks.data(), CHUNKS_COUNT, B.chunks.data(), CHUNKS_COUNT);
+        return set_rounded(W, 2 * CHUNKS_COUNT, get_least_significant_exponent() + B.get_least_significant_exponent(), is_negative != B.is_negative);
+    }
+
+    /** \note   B == 0 sets was_divided_by_zero and leaves this unchanged, as BigDecimal::div_fractional does. */
+    auto div_fractional(FixedBigDecimal const& B) -> FixedBigDecimal& {
+        if (B.is_zero()) {
+            was_divided_by_zero = true;
+            return *this;
+        }
+        if (is_zero()) return *this;
+
+        // A * 2^Shift / B has at least Bits+2 bits, the remainder only decides the sticky bit
+        i32 Shift = Bits + 2 + B.get_msb() - get_msb();
+        i32 LSE = get_least_significant_exponent() - Shift - B.get_least_significant_exponent();
+
+        ChunkBits Num[WIDE_CHUNKS_COUNT];
+        place_chunks(Num, *this, Shift);
+
+        i32 Bn = BigDecimal_::significant_chunks(B.chunks.data(), CHUNKS_COUNT);
+        ChunkBits Quotient[WIDE_CHUNKS_COUNT] = {};
+        ChunkBits ScratchChunks[2 * WIDE_CHUNKS_COUNT + 1];
+        BigDecimal_::ChunkScratch Scratch {ScratchChunks, ScratchChunks + 2 * WIDE_CHUNKS_COUNT + 1};
+        BigDecimal_::div_chunks_knuth(Quotient, Num, WIDE_CHUNKS_COUNT, B.chunks.data(), Bn, Scratch);
+
+        bool Sticky = false;
+        for (i32 Idx = 0 ; Idx < Bn ; ++Idx) Sticky |= Num[Idx] != 0x0;
+        return set_rounded(Quotient, WIDE_CHUNKS_COUNT - Bn + 1, LSE, is_negative != B.is_negative, Sticky);
+    }
+
+    /** \note   round-to-even, with subnormals. values beyond the range of f64 become infinities, there is no NaN to return. */
+    auto to_double() const -> f64 {
+        if (is_zero()) return is_negative ? -0.0 : 0.0;
+        i32 Count = BigDecimal_::significant_chunks(chunks.data(), CHUNKS_COUNT);
+        return std::bit_cast<f64>(BigDecimal_::round_to_float_bits(chunks.data(), Count, exponent, is_negative, DOUBLE_PRECISION, 11));
+    }
+
+private:
+    /** \brief  Dst[0..WIDE_CHUNKS_COUNT) = Src's chunks shifted by Shift (right if negative)
+     *  \return whether 1 bits were shifted out at the bottom
+     */
+    static auto place_chunks(ChunkBits *Dst, FixedBigDecimal const& Src, i32 Shift) -> bool {
+        BigDecimal_::zero_chunks(Dst, WIDE_CHUNKS_COUNT);
+        i32 Count = BigDecimal_::significant_chunks(Src.chunks.data(), CHUNKS_COUNT);
+        if (Shift >= 0) {
+            i32 ShiftChunks = Shift / CHUNK_WIDTH;
+            ChunkBits Out = BigDecimal_::shift_left_chunks(Dst + ShiftChunks, Src.chunks.data(), Count, Shift % CHUNK_WIDTH);
+            if (ShiftChunks + Count < WIDE_CHUNKS_COUNT) Dst[ShiftChunks + Count] = Out;
+            return false;
+        }
+        i32 RightShift = -Shift;
+        if (RightShift > Src.get_msb()) return true;
+        i32 ShiftChunks = RightShift / CHUNK_WIDTH;
+        bool Sticky = Src.chunks[ShiftChunks] & GetMaskBottomN<ChunkBits>(RightShift % CHUNK_WIDTH);
+        for (i32 Idx = 0 ; Idx < ShiftChunks ; ++Idx) Sticky |= Src.chunks[Idx] != 0x0;
+        BigDecimal_::shift_right_chunks(Dst, Src.chunks.data() + ShiftChunks, Count - ShiftChunks, RightShift % CHUNK_WIDTH);
+        return Sticky;
+    }
+
+    /** \brief  this += (-1)^BNegative * |B|
+     *  \note   the operand with the higher exponent is placed with its leading 1 just below the top of a wide buffer,
+     *          leaving a chunk and more of guard bits below it. what the other operand loses at the bottom is
+     *          jammed into bit 0, far below the rounding position, which rounds the same as the exact sum.
+     */
+    auto add_signed(FixedBigDecimal const& B, bool BNegative) -> FixedBigDecimal& {
+        if (B.is_zero()) return *this;
+        if (is_zero()) {
+            *this = B;
+            is_negative = BNegative;
+            return *this;
+        }
+
+        bool ThisIsBig = exponent >= B.exponent;
+        FixedBigDecimal const& Big   = ThisIsBig ? *this : B;
+        FixedBigDecimal const& Small = ThisIsBig ? B : *this;
+        bool BigNegative   = ThisIsBig ? is_negative : BNegative;
+        bool SmallNegative = ThisIsBig ? BNegative : is_negative;
+
+        constexpr i32 TOP = WIDE_CHUNKS_COUNT * CHUNK_WIDTH - 2; //NOTE(##2026 10 18): one bit of room for the carry
+        ChunkBits W[WIDE_CHUNKS_COUNT];
+        ChunkBits V[WIDE_CHUNKS_COUNT];
+        place_chunks(W, Big, TOP - Big.get_msb());
+        bool Sticky = place_chunks(V, Small, TOP - (Big.exponent - Small.exponent) - Small.get_msb());
+        V[0] |= Sticky;
+        i32 LSE = Big.exponent - TOP;
+
+        bool Negative = BigNegative;
+        if (BigNegative == SmallNegative) {
+            BigDecimal_::add_chunks(W, W, V, WIDE_CHUNKS_COUNT);
+        } else if (BigDecimal_::compare_chunks(W, V, WIDE_CHUNKS_COUNT) >= 0) {
+            BigDecimal_::sub_chunks(W, W, V, WIDE_CHUNKS_COUNT);
+        } else {
+            BigDecimal_::sub_chunks(W, V, W, WIDE_CHUNKS_COUNT);
+            Negative = SmallNegative;
+        }
+        return set_rounded(W, WIDE_CHUNKS_COUNT, LSE, Negative);
+    }
+};
+
+template <i32 Bits> auto operator+(FixedBigDecimal<Bits> A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits> { return A.add_fractional(B); }
+template <i32 Bits> auto operator-(FixedBigDecimal<Bits> A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits> { return A.sub_fractional(B); }
+template <i32 Bits> auto operator*(FixedBigDecimal<Bits> A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits> { return A.mul_fractional(B); }
+template <i32 Bits> auto operator/(FixedBigDecimal<Bits> A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits> { return A.div_fractional(B); }
+template <i32 Bits> auto operator-(FixedBigDecimal<Bits> A) -> FixedBigDecimal<Bits> { return A.neg(); }
+template <i32 Bits> auto operator<=>(FixedBigDecimal<Bits> const& A, FixedBigDecimal<Bits> const& B) -> std::strong_ordering { return A.compare_fractional(B); }
+template <i32 Bits> auto operator==(FixedBigDecimal<Bits> const& A, FixedBigDecimal<Bits> const& B) -> bool { return A.equals_fractional(B); }
+
+template <i32 Bits> auto operator+=(FixedBigDecimal<Bits>& A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits>& { return A.add_fractional(B); }
+template <i32 Bits> auto operator-=(FixedBigDecimal<Bits>& A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits>& { return A.sub_fractional(B); }
+template <i32 Bits> auto operator*=(FixedBigDecimal<Bits>& A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits>& { return A.mul_fractional(B); }
+template <i32 Bits> auto operator/=(FixedBigDecimal<Bits>& A, FixedBigDecimal<Bits> const& B) -> FixedBigDecimal<Bits>& { return A.div_fractional(B); }
+
+
 template <typename uN>
 void FullMulN(uN A, uN B, uN C[2]) {
 
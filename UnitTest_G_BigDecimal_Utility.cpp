@@ -7,7 +7,12 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <thread>
+#include <vector>
+#include <string>
 #include <stdio.h>
+#include <cfenv>
+#include <cmath>
 
 
 #include "Memoryapi.h" //VirtuaAlloc()
@@ -113,18 +118,18 @@ i32 Test_big_decimal(bool only_errors = false) {
     std::cout << std::boolalpha;
 
 #if 1
-    Tests.Append(A.length >= 1 && A.get_chunk(0)->value == i32{9});
+    Tests.Append(A.length >= 1 && *A.get_chunk(0) == i32{9});
     Print(A,&StringArena);
 
-    Tests.Append(B.length >= 1 && B.get_chunk(0)->value == i32{10});
+    Tests.Append(B.length >= 1 && *B.get_chunk(0) == i32{10});
     Print(B,&StringArena);
 
     B.add_integer_signed(A);
-    Tests.Append(B.length == 1 && B.get_chunk(0)->value == 19U);
+    Tests.Append(B.length == 1 && *B.get_chunk(0) == 19U);
     Print(B,&StringArena);
 
     A.neg();
-    Tests.Append(A.length == 1 && A.get_chunk(0)->value == 9U && A.is_negative);
+    Tests.Append(A.length == 1 && *A.get_chunk(0) == 9U && A.is_negative);
     Print(A,&StringArena);
 
     {
@@ -482,14 +487,14 @@ i32 Test_big_decimal(bool only_errors = false) {
             u32 LeastBitIdx = Pow%CHUNK_WIDTH;
             u32 LeastChunkIdx = Pow/CHUNK_WIDTH;;
 
-            bool LastNBitsGood = A.get_chunk(LeastChunkIdx)->value & (1ull<<LeastBitIdx);
+            bool LastNBitsGood = *A.get_chunk(LeastChunkIdx) & (1ull<<LeastBitIdx);
             if (!LastNBitsGood) {
                 cout << "ERROR: " << Pow << ", " << Pow << '\n';
             }
             for (u32 BitIdx = 0 ; BitIdx < Pow-1 ; ++BitIdx) {
                 u32 LocalBitIdx = BitIdx%CHUNK_WIDTH;;
                 u32 ChunkIdx = BitIdx/CHUNK_WIDTH;;
-                LastNBitsGood = LastNBitsGood && ~(A.get_chunk(ChunkIdx)->value)&(1ull<<LocalBitIdx);
+                LastNBitsGood = LastNBitsGood && ~(*A.get_chunk(ChunkIdx))&(1ull<<LocalBitIdx);
                 if (!LastNBitsGood) {
                     cout << "ERROR: " << Pow << ", " << BitIdx << '\n';
                 }
@@ -802,6 +807,51 @@ i32 Test_big_decimal(bool only_errors = false) {
         CheckQuo();
     }
 
+    {
+        //multi chunk divisor: A = Q * B exactly, then A = Q * B + 1
+        cout << "Test#" << Tests.TestCount << " : multi chunk divisor\n";
+        ChunkBits ValuesQ[] {0x0123'4567'89AB'CDEF, 0xFEDC'BA98'7654'3210, 0x1};
+        ChunkBits ValuesB[] {0xFFFF'FFFF'FFFF'FFFF, 0x0, 0xDEAD'BEEF'0000'0001};
+        ExpectedInteger.set(ValuesQ, ArrayCount(ValuesQ), 1);
+        B.set(ValuesB, ArrayCount(ValuesB));
+        ExpectedInteger.copy_to(&A);
+        A.mul_integer(B);
+        ExpectedFraction.set(0);
+
+        div_integer(A, B, QuoInt, QuoFrac, 52);
+        bool OK = QuoInt.equals_integer(ExpectedInteger) && QuoFrac.is_zero();
+        OK &= QuoInt.exponent == QuoInt.count_bits() - 1 && QuoInt.is_negative;
+        Tests.Append(OK);
+
+        BigDec_Arena One { virtual_alloc_arena_alloc_1, 1 };
+        A.is_negative = false;
+        A.add_integer_unsigned(One);
+        ExpectedInteger.is_negative = false;
+        div_integer(A, B, QuoInt, QuoFrac, 52);
+        OK = QuoInt.equals_integer(ExpectedInteger) && !QuoInt.is_negative;
+        OK &= QuoFrac.exponent == -B.count_bits() && QuoFrac.count_bits() >= 52 && QuoFrac.is_normalized_fractional();
+        Tests.Append(OK);
+    }
+
+    {
+        //integer part of the quotient with trailing zeros
+        A.set(6);
+        B.set(3);
+        A.div_integer(B); // A = 2
+        u32 ValuesExpected[] { 0b1 };
+        Expected.set(ValuesExpected, ArrayCount(ValuesExpected), 0, 1);
+        cout << "Test #" << Tests.TestCount << " : 6/3 = " << string(A) << "\n";
+        Tests.Append(A.equals_fractional(Expected));
+
+        A.set(13);
+        B.set(6);
+        A.div_integer(B, 8); // A = 13/6 = 10.0010101010...
+        u32 ValuesExpected_1[] { 0b1'0001'0101'0101 };
+        Expected.set(ValuesExpected_1, ArrayCount(ValuesExpected_1), 0, 1);
+        cout << "Test #" << Tests.TestCount << " : 13/6 = " << string(A) << "\n";
+        Tests.Append(A.equals_fractional(Expected));
+    }
+
     {
         //Test copy constructor
         u32 ValuesA[] { 0x0000'0000, 0x0FFFF'FFFF };
@@ -1580,8 +1630,8 @@ Test_Parsing(bool only_errors = false) {
 
         for (size_t i = 0 ; i < ArrayCount(Input) ; ++i) {
             bool Passed = BigDec_Arena::parse_integer(Input[i]);
-            BigDec_Arena::temp_parse_int.normalize();
-            Buf[0] = BigDec_Arena::temp_parse_int.to_float();
+            BigDec_Arena::workspace().temp_parse_int.normalize();
+            Buf[0] = BigDec_Arena::workspace().temp_parse_int.to_float();
             Passed &= Buf[0] == Expected[i];
 
             const char *CheckMsg = Passed ? "OK"  : "ERROR";
@@ -1610,7 +1660,7 @@ Test_Parsing(bool only_errors = false) {
 
         for (size_t i = 0 ; i < ArrayCount(Input) ; ++i) {
             bool Passed = BigDec_Arena::from_string(Input[i]);
-            Buf[0] = BigDec_Arena::temp_from_string.to_float();
+            Buf[0] = BigDec_Arena::workspace().temp_from_string.to_float();
             Passed &= Buf[0] == Expected[i];
             const char *CheckMsg = Passed ? "OK"  : "ERROR";
 
@@ -1634,8 +1684,8 @@ Test_Parsing(bool only_errors = false) {
         for (size_t i = 0 ; i < ArrayCount(Input) ; ++i) {
 
             bool Passed = !BigDec_Arena::parse_integer(Input[i]);
-            BigDec_Arena::temp_parse_int.normalize();
-            Buf[0] = BigDec_Arena::temp_parse_int.to_float();
+            BigDec_Arena::workspace().temp_parse_int.normalize();
+            Buf[0] = BigDec_Arena::workspace().temp_parse_int.to_float();
 
             const char *CheckMsg = Passed ? "OK ( failed )"  : "ERROR";
 
@@ -1736,6 +1786,104 @@ Test_Parsing(bool only_errors = false) {
 //        CheckA();
         cout << "\nEYEBALL TEST: 1234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890 = " << string(A) << '\n';
     }
+
+    {
+        cout << "\nTesting BigDecimal::parse_integer() on long inputs ... \n";
+        BigDecimal_::RadixThresholds OldThresholds = BigDecimal_::radix_thresholds;
+
+        constexpr i32 DigitCount = 2000;
+        static char NumStr[DigitCount+1] = {};
+        NumStr[0] = '1';
+        for (i32 i = 1 ; i < DigitCount ; ++i) NumStr[i] = '0';
+        BigDec_Arena::parse_integer(NumStr, &A);
+        Expected.set(1);
+        B.set(10);
+        for (i32 i = 1 ; i < DigitCount ; ++i) Expected.mul_integer(B);
+        Tests.Append(A.equal_bits(Expected));
+
+        for (i32 i = 0 ; i < DigitCount ; ++i) NumStr[i] = static_cast<char>('0' + (i * 7 + i / 13) % 10);
+        BigDecimal_::radix_thresholds.parse = 1 << 30;
+        BigDec_Arena::parse_integer(NumStr, &Expected);
+        i32 Thresholds[] {2, 3, 32};
+        for (i32 Threshold : Thresholds) {
+            BigDecimal_::radix_thresholds.parse = Threshold;
+            BigDec_Arena::parse_integer(NumStr, &A);
+            Tests.Append(A.equal_bits(Expected) && A.exponent == Expected.exponent);
+        }
+
+        BigDecimal_::radix_thresholds = OldThresholds;
+    }
+
+    {
+        cout << "\nTesting BigDecimal::parse_fraction() ... \n";
+        // 0.1 = 1.1001 1001 ... x 2^-4, rounded to 192 bits the last nibble 1100 rounds up to 1101
+        u64 ValuesExpected[] {0xCCCC'CCCC'CCCC'CCCD, 0xCCCC'CCCC'CCCC'CCCC, 0xCCCC'CCCC'CCCC'CCCC};
+        Expected.set(ValuesExpected, ArrayCount(ValuesExpected), false, -4);
+        Expected.normalize();
+
+        char Short[] = "1";
+        BigDec_Arena::parse_fraction(Short, &A, 192);
+        Tests.Append(A.equals_fractional(Expected));
+
+        constexpr i32 DigitCount = 2000;
+        static char Long[DigitCount+1] = {};
+        Long[0] = '1';
+        for (i32 i = 1 ; i < DigitCount ; ++i) Long[i] = '0';
+        BigDec_Arena::parse_fraction(Long, &A, 192);
+        Tests.Append(A.equals_fractional(Expected));
+
+        char Half[] = "5000";
+        BigDec_Arena::parse_fraction(Half, &A, 1);
+        Expected.set(1, false, -1);
+        Tests.Append(A.equals_fractional(Expected));
+    }
+
+    {
+        cout << "\nTesting to_decimal_chars() ... \n";
+        using BigDecimal_::DecimalFormat;
+        std::allocator<char> CharAlloc;
+        auto Check = [&](DecimalFormat Format, i32 Precision, char const *Wanted) {
+            char *Out = to_decimal_chars(A, CharAlloc, Format, Precision);
+            cout << Out << "\n";
+            Tests.Append(string(Out) == Wanted);
+            CharAlloc.deallocate(Out, StringLength(Out) + 1);
+        };
+
+        A.set_double(0.1);
+        Check(DecimalFormat::SHORTEST, DOUBLE_PRECISION, "0.1");
+        Check(DecimalFormat::FIXED, -1, "0.1000000000000000055511151231257827021181583404541015625");
+        Check(DecimalFormat::SCIENTIFIC, 3, "1.000e-01");
+
+        A.set_double(9.75);
+        A.is_negative = true;
+        Check(DecimalFormat::FIXED, 1, "-9.8");
+        Check(DecimalFormat::SCIENTIFIC, -1, "-9.75e+00");
+
+        A.set_double(1e23);
+        Check(DecimalFormat::SHORTEST, DOUBLE_PRECISION, "1e+23");
+
+        A.zero(BigDec_Arena::ZERO_EVERYTHING);
+        Check(DecimalFormat::FIXED, 2, "0.00");
+
+        A.set_double(-0.001);
+        Check(DecimalFormat::FIXED, 2, "0.00");
+        Check(DecimalFormat::FIXED, 0, "0");
+        Check(DecimalFormat::FIXED, 3, "-0.001");
+        A.set_double(-0.005);
+        Check(DecimalFormat::FIXED, 2, "-0.01"); //the double is a bit above 0.005
+
+        BigDecimal_::RadixThresholds OldThresholds = BigDecimal_::radix_thresholds;
+        constexpr i32 DigitCount = 2000;
+        static char NumStr[DigitCount+1] = {};
+        for (i32 i = 0 ; i < DigitCount ; ++i) NumStr[i] = static_cast<char>('1' + (i * 7 + i / 13) % 9);
+        BigDec_Arena::parse_integer(NumStr, &A);
+        i32 Thresholds[] {2, 32};
+        for (i32 Threshold : Thresholds) {
+            BigDecimal_::radix_thresholds.print = Threshold;
+            Check(DecimalFormat::FIXED, -1, NumStr);
+        }
+        BigDecimal_::radix_thresholds = OldThresholds;
+    }
 #if ACTIVATE_ALL_TESTS
     {
         char NumStr[] = "\
@@ -1945,6 +2093,45 @@ void unit_test_context_variables_count(test_result& Tests, char *test_label, i32
     Tests.Append(OK);
 }
 
+//NOTE(##2026 10 18): whether Lhs + Rhs builds an expression, i.e. which operands the expression operators take
+template <typename T_Lhs, typename T_Rhs>
+concept ExprAddable = requires (T_Lhs&& A, T_Rhs&& B) { std::forward<T_Lhs>(A) + std::forward<T_Rhs>(B); };
+
+//NOTE(##2026 10 18): FixedBigDecimal<Bits> against BigDecimal rounded to Bits, on random operands of Bits significant bits
+template <i32 Bits>
+bool fixed_agrees_with_big_decimal(u64 state) {
+    using Fixed = FixedBigDecimal<Bits>;
+    using BigDecimal_::RoundingContext;
+    auto next_random = [&state]() { state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+    Big_Dec_Std::Workspace& ws = Big_Dec_Std::workspace();
+    RoundingContext Rounding {Bits};
+    bool OK = true;
+    for (i32 Round = 0 ; Round < 16 ; ++Round) {
+        ChunkBits BitsA[Fixed::CHUNKS_COUNT], BitsB[Fixed::CHUNKS_COUNT];
+        for (i32 Idx = 0 ; Idx < Fixed::CHUNKS_COUNT ; ++Idx) {
+            BitsA[Idx] = next_random();
+            BitsB[Idx] = next_random();
+        }
+        BitsA[Fixed::CHUNKS_COUNT-1] |= 1ull << 63;
+        BitsB[Fixed::CHUNKS_COUNT-1] |= 1ull << 63;
+        Big_Dec_Std A, B, Expected;
+        A.set(BitsA, Fixed::CHUNKS_COUNT, Round % 2 == 1, static_cast<i32>(next_random() % 200) - 100);
+        B.set(BitsB, Fixed::CHUNKS_COUNT, Round % 3 == 1, static_cast<i32>(next_random() % 200) - 100);
+        A.normalize();
+        B.normalize();
+        A.round_to_n_significant_bits(Bits);
+        B.round_to_n_significant_bits(Bits);
+        Fixed FA {A}, FB {B};
+
+        Expected = A; Expected.add_fractional(B, ws, Rounding); OK &= (FA + FB).equals_fractional(Fixed{Expected});
+        Expected = A; Expected.sub_fractional(B, ws, Rounding); OK &= (FA - FB).equals_fractional(Fixed{Expected});
+        Expected = A; Expected.mul_fractional(B, ws, Rounding); OK &= (FA * FB).equals_fractional(Fixed{Expected});
+        Expected = A; Expected.div_fractional(B, ws, Rounding); OK &= (FA / FB).equals_fractional(Fixed{Expected});
+        OK &= FA.to_double() == A.to_double();
+    }
+    return OK;
+}
+
 int Test_new_allocator_interface() {
 
     using std::cout;
@@ -1961,7 +2148,7 @@ int Test_new_allocator_interface() {
 
     {
         cout << "Test #" << Tests.TestCount << "\n";
-        cout << "- BigDecimal::release(): length == 1, capacity == 1, data.next == 0, sentinel == &data, allocator.meta == nullptr \n";
+        cout << "- BigDecimal::release(): length == 1, capacity == 1, chunks == m_inline_chunks, allocator.meta == nullptr \n";
 
         Big_Dec_Std::initialize_context();
         ChunkBits Bits[] = {1,2,3};
@@ -1973,8 +2160,7 @@ int Test_new_allocator_interface() {
 
         OK = A.length == 1;
         OK &= A.m_chunks_capacity == 1;
-        OK &= A.data.next == nullptr;
-        OK &= A.sentinel == &A.data;
+        OK &= A.chunks == A.m_inline_chunks;
 
         cout << "After : " << A << "\n";
         cout << ( OK ? "OK" : "ERROR") << "\n";
@@ -2057,15 +2243,15 @@ int Test_new_allocator_interface() {
 
         BigDecimal my_num = BigDecimal();
 
-        unit_test_context_variables_count<Big_Dec_Std>(Tests, "user created context variable", Big_Dec_Std::TEMPORARIES_COUNT + 1);
+        unit_test_context_variables_count<Big_Dec_Std>(Tests, "user created variable, only the workspace temporaries are context variables", Big_Dec_Std::TEMPORARIES_COUNT);
 
         my_num.extend_length();
-        my_num.data.next->value = static_cast<ChunkBits>(0x12345678);
+        my_num.chunks[1] = static_cast<ChunkBits>(0x12345678);
 
         OK = true;
         OK &= my_num.m_chunks_capacity == 2;
         OK &= my_num.length == 2;
-        OK &= my_num.data.next && my_num.data.next->value == static_cast<ChunkBits>(0x12345678);
+        OK &= my_num.chunks[1] == static_cast<ChunkBits>(0x12345678);
         cout << "Test #" << Tests.TestCount << "\n";
         cout << "extend_length() -> new chunk allocated: " << (OK ? "OK" : "ERROR") << "\n\n";
         Tests.Append(OK);
@@ -2081,6 +2267,115 @@ int Test_new_allocator_interface() {
         Tests.Append(OK);
     }
 
+    {
+        cout << "Test #" << Tests.TestCount << "\n";
+        cout << "Big_Dec_Std : independent computations on several threads, one workspace per thread\n";
+
+        Big_Dec_Std::initialize_context();
+
+        auto Compute = [](i32 Seed) -> std::string {
+            std::string Digits;
+            for (i32 i = 0 ; i < 300 + Seed ; ++i) Digits += char('1' + (i * 7 + Seed) % 9);
+            Big_Dec_Std A;
+            Big_Dec_Std::parse_integer(Digits.data(), &A);
+            A.mul_integer(A);
+            Big_Dec_Std B {987654321u + Seed};
+            A.div_integer(B, 64);
+            std::allocator<char> CharAlloc;
+            char *Str = to_decimal_chars(A, CharAlloc, BigDecimal_::DecimalFormat::SCIENTIFIC, 50);
+            std::string Result {Str};
+            CharAlloc.deallocate(Str, Result.size() + 1);
+            return Result;
+        };
+
+        constexpr i32 THREAD_COUNT = 4;
+        std::string Expected[THREAD_COUNT], Results[THREAD_COUNT];
+        for (i32 i = 0 ; i < THREAD_COUNT ; ++i) Expected[i] = Compute(i);
+
+        std::vector<std::thread> Workers;
+        for (i32 i = 0 ; i < THREAD_COUNT ; ++i) {
+            Workers.emplace_back([&, i]() { for (i32 Round = 0 ; Round < 8 ; ++Round) Results[i] = Compute(i); });
+        }
+        for (std::thread& Worker : Workers) Worker.join();
+
+        OK = true;
+        for (i32 i = 0 ; i < THREAD_COUNT ; ++i) {
+            OK &= Results[i] == Expected[i];
+        }
+        cout << Results[0] << "\n";
+        cout << ( OK ? "PASSED" : "ERROR" ) << "\n\n";
+        Tests.Append(OK);
+
+        unit_test_context_variables_count<Big_Dec_Std>(Tests, "workspaces of finished threads are released", Big_Dec_Std::TEMPORARIES_COUNT);
+
+        //each thread lists its own temporaries, closing the context here leaves a live worker's workspace to the worker
+        std::atomic<i32> Stage {0};
+        i32 WorkerCount = 0;
+        std::thread Holder {[&]() {
+            Big_Dec_Std::workspace();
+            WorkerCount = Big_Dec_Std::s_ctx_count;
+            Stage = 1;
+            while (Stage != 2) std::this_thread::yield();
+        }};
+        while (Stage != 1) std::this_thread::yield();
+        OK = WorkerCount == Big_Dec_Std::TEMPORARIES_COUNT && Big_Dec_Std::s_ctx_count == Big_Dec_Std::TEMPORARIES_COUNT;
+        Big_Dec_Std::close_context();
+        OK &= Big_Dec_Std::s_ctx_count == 0 && Big_Dec_Std::s_ctx_links == nullptr;
+        Stage = 2;
+        Holder.join();
+
+        cout << "Test #" << Tests.TestCount << " - context variables are counted per thread\n";
+        cout << ( OK ? "PASSED" : "ERROR" ) << "\n\n";
+        Tests.Append(OK);
+    }
+
+    {
+        cout << "Test #" << Tests.TestCount << "\n";
+        cout << "BigDec_Arena : explicit workspace on an arena of its own, reset between batches\n";
+
+        size_t ctx_size = Kilobytes(64);
+        ArenaChunkAlloc ctx_alloc{ctx_size, new u8[ctx_size](), deleter_std};
+        BigDec_Arena::initialize_context(ctx_alloc);
+
+        size_t ws_size = Kilobytes(16);
+        ArenaChunkAlloc ws_alloc{ws_size, new u8[ws_size](), deleter_std};
+        OK = true;
+        {
+            BigDec_Arena::Workspace ws {ws_alloc};
+            OK &= BigDec_Arena::s_ctx_count == BigDec_Arena::TEMPORARIES_COUNT;
+
+            for (i32 Batch = 0 ; Batch < 4 ; ++Batch) {
+                char Str[] = "31415926535897932384626433832795028841971.6939937510582097494459230781640628620899";
+                BigDec_Arena A, B, Expected, Divisor;
+                BigDec_Arena::from_string(Str, ws, &A, 192);
+                BigDec_Arena::from_string(Str, &Expected, 192);
+                OK &= A.equals_fractional(Expected);
+
+                B.set(7 + Batch);
+                B.normalize();
+                Divisor.set(7 + Batch);
+                Divisor.normalize();
+                A.mul_fractional(A, ws);
+                Expected.mul_fractional(Expected);
+                A.div_fractional(B, ws, 128);
+                Expected.div_fractional(Divisor, 128);
+                A.add_fractional(B, ws);
+                Expected.add_fractional(Divisor);
+                OK &= A.equals_fractional(Expected);
+                OK &= A.to_double() == Expected.to_double();
+
+                ws.reset();
+                OK &= ws_alloc.meta->arena.Used == sizeof(ArenaAllocMeta);
+            }
+        }
+        OK &= ws_alloc.get_ref_count() == 1;
+
+        cout << ( OK ? "PASSED" : "ERROR" ) << "\n\n";
+        Tests.Append(OK);
+
+        BigDec_Arena::close_context();
+    }
+
     {
         cout << "calling style with user-provided allocator param - arena allocator.\n";
 
@@ -2098,15 +2393,15 @@ int Test_new_allocator_interface() {
 
         BigDec_Arena my_num{std_new_arena_alloc_1,1,false,0};
 
-        unit_test_context_variables_count<BigDec_Arena>(Tests, "Big Decimal with Arena with 1 user variable in context", BigDec_Arena::TEMPORARIES_COUNT+1);
+        unit_test_context_variables_count<BigDec_Arena>(Tests, "Big Decimal with Arena with 1 user variable, not in context", BigDec_Arena::TEMPORARIES_COUNT);
 
         my_num.extend_length();
-        my_num.data.next->value = static_cast<ChunkBits>(0x12345678);
+        my_num.chunks[1] = static_cast<ChunkBits>(0x12345678);
 
         bool OK = true;
         OK &= my_num.m_chunks_capacity == 2;
         OK &= my_num.length == 2;
-        OK &= my_num.data.next && my_num.data.next->value == static_cast<ChunkBits>(0x12345678);
+        OK &= my_num.chunks[1] == static_cast<ChunkBits>(0x12345678);
 
         cout << "Test #" << Tests.TestCount << "\n";
         cout << "capacity increased after extend_length(): " << (OK ? "OK" : "ERROR") << " ( " << my_num << " )\n\n";
@@ -2210,12 +2505,12 @@ int Test_new_allocator_interface() {
 
         {
             BigDec_Arena my_num {0.f};
-            unit_test_context_variables_count<BigDec_Arena>(Tests, " - ctor(float) with default arena allocator\n", BigDec_Arena::TEMPORARIES_COUNT + 1);
+            unit_test_context_variables_count<BigDec_Arena>(Tests, " - ctor(float) with default arena allocator\n", BigDec_Arena::TEMPORARIES_COUNT);
 
             Big_Dec_Std::initialize_context();
 
             Big_Dec_Std my_num_std {1.f};
-            unit_test_context_variables_count<Big_Dec_Std>(Tests, " - ctor(float) with default std::allocator\n", Big_Dec_Std::TEMPORARIES_COUNT + 1);
+            unit_test_context_variables_count<Big_Dec_Std>(Tests, " - ctor(float) with default std::allocator\n", Big_Dec_Std::TEMPORARIES_COUNT);
         }
 
         {
@@ -2242,6 +2537,935 @@ int Test_new_allocator_interface() {
             Tests.Append(OK);
         }
 
+        {
+            OK = true;
+            ChunkBits Bits[] = {1,2,3};
+            Big_Dec_Std A {Bits, 3, true, 5};
+            Big_Dec_Std Expected {Bits, 3, true, 5};
+            ChunkBits *Block = A.chunks;
+
+            Big_Dec_Std Moved {std::move(A)};
+            OK &= Moved.chunks == Block && Moved.equals_integer(Expected) && Moved.exponent == 5;
+            OK &= A.is_zero() && A.chunks == A.m_inline_chunks;
+
+            Big_Dec_Std Small {7u};
+            swap(Small, Moved);
+            OK &= Small.chunks == Block && Small.equals_integer(Expected);
+            OK &= Moved.chunks == Moved.m_inline_chunks && Moved.chunks[0] == 7 && Moved.length == 1;
+
+            Big_Dec_Std Assigned {1u};
+            Assigned = std::move(Small);
+            OK &= Assigned.chunks == Block && Assigned.equals_integer(Expected) && Small.is_zero();
+
+            Big_Dec_Std Copied {1u};
+            Copied = Assigned;
+            OK &= Copied.chunks != Assigned.chunks && Copied.equals_integer(Assigned) && Copied.exponent == 5;
+
+            size_t arena_size = Kilobytes(1);
+            ArenaChunkAlloc arena_1{arena_size, new u8[arena_size](), deleter_std};
+            ArenaChunkAlloc arena_2{arena_size, new u8[arena_size](), deleter_std};
+            BigDec_Arena X {arena_1, Bits, 3};
+            BigDec_Arena Y {arena_2, 9u};
+            BigDec_Arena ExpectedX {arena_2, Bits, 3};
+            X.swap(Y);
+            OK &= Y.equals_integer(ExpectedX) && X.length == 1 && X.chunks[0] == 9;
+
+            cout << "Test# " << Tests.TestCount << " - move, swap and copy assignment\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            Big_Dec_Std A, B, C, D, E;
+            Big_Dec_Std::from_string((char*)"3.25", &A);
+            Big_Dec_Std::from_string((char*)"-1.5", &B);
+            Big_Dec_Std::from_string((char*)"7.125", &C);
+            Big_Dec_Std::from_string((char*)"0.3", &D, 100);
+            Big_Dec_Std::from_string((char*)"12345678901234567890.5", &E);
+
+            Big_Dec_Std Result, Expected, Temp;
+            Result = A*B + C*D - E;
+            Expected = A; Expected.mul_fractional(B);
+            Temp = C; Temp.mul_fractional(D);
+            Expected.add_fractional(Temp);
+            Expected.sub_fractional(E);
+            OK &= Result.equals_fractional(Expected);
+
+            //aliasing the destination on the right hand side
+            Result = A;
+            Result = (Result*B) / (C - Result);
+            Expected = A; Expected.mul_fractional(B);
+            Temp = C; Temp.sub_fractional(A);
+            Expected.div_fractional(Temp);
+            OK &= Result.equals_fractional(Expected);
+
+            Result = C;
+            Result -= B*D;
+            Expected = C; Temp = B; Temp.mul_fractional(D); Expected.sub_fractional(Temp);
+            OK &= Result.equals_fractional(Expected);
+
+            Big_Dec_Std Zero {0u};
+            Big_Dec_Std Constructed = A + B / Zero;
+            OK &= Constructed.was_divided_by_zero;
+            Constructed = A + B;
+            OK &= !Constructed.was_divided_by_zero;
+
+            //const operands, and only lvalue BigDecimal operands (expressions may be temporaries)
+            Big_Dec_Std const Half {1u, false, -1};
+            Big_Dec_Std const& ConstC = C;
+            Result = Half * A + ConstC;
+            Expected = A; Temp = Half; Expected.mul_fractional(Temp); Expected.add_fractional(C);
+            OK &= Result.equals_fractional(Expected);
+            static_assert(ExprAddable<Big_Dec_Std const&, Big_Dec_Std&>);
+            static_assert(ExprAddable<decltype(A*B), Big_Dec_Std const&>);
+            static_assert(!ExprAddable<Big_Dec_Std&, Big_Dec_Std>);
+            static_assert(!ExprAddable<Big_Dec_Std, decltype(A*B)>);
+
+            //right operands nested deeper than EXPR_TEMPORARIES_COUNT, the innermost one fused, with and without aliasing
+            static_assert(Big_Dec_Std::EXPR_TEMPORARIES_COUNT < 11);
+            Big_Dec_Std *Chain[] = {&A, &B, &C, &A, &B, &C, &A, &B, &C, &A, &B};
+            Expected = B; Expected.mul_fractional(D); Temp = C; Temp.sub_fractional(Expected); Expected = Temp;
+            for (i32 Idx = 10 ; Idx >= 0 ; --Idx) {
+                Temp = *Chain[Idx]; Temp.sub_fractional(Expected); Expected = Temp;
+            }
+            Result = A - (B - (C - (A - (B - (C - (A - (B - (C - (A - (B - (C - B*D)))))))))));
+            OK &= Result.equals_fractional(Expected);
+            Result = B;
+            Result = A - (B - (C - (A - (B - (C - (A - (B - (C - (A - (B - (C - Result*D)))))))))));
+            OK &= Result.equals_fractional(Expected);
+
+            cout << "Test# " << Tests.TestCount << " - expression operators\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            Big_Dec_Std A, B, C;
+            Big_Dec_Std::from_string((char*)"3.14159265358979323846", &A, 100);
+            Big_Dec_Std::from_string((char*)"-2.5", &B);
+            Big_Dec_Std::from_string((char*)"1234.0625", &C);
+
+            Big_Dec_Std Result, Expected;
+            fma(A, B, C, Result);
+            Expected = A; Expected.mul_fractional(B); Expected.add_fractional(C);
+            OK &= Result.equals_fractional(Expected);
+
+            fma(A, B, C, Result, 53);
+            Expected.round_to_n_significant_bits(53);
+            OK &= Result.equals_fractional(Expected);
+
+            //Result aliasing an operand
+            Result = C;
+            Result.fma_fractional(B, Result);
+            Expected = C; Expected.mul_fractional(B); Expected.add_fractional(C);
+            OK &= Result.equals_fractional(Expected);
+
+            Big_Dec_Std Three {3u}, Five {5u}, MinusFifteen {15u, true};
+            fma(Three, Five, MinusFifteen, Result);
+            OK &= Result.is_zero();
+
+            //an exact cancellation in the fused expressions is +0, like x - x
+            Big_Dec_Std One {1u}, PlusZero {};
+            Result = A * One - A;
+            OK &= Result.equals_fractional(PlusZero);
+            Result = A - A * One;
+            OK &= Result.equals_fractional(PlusZero);
+            Result = A - A;
+            OK &= Result.equals_fractional(PlusZero);
+
+            cout << "Test# " << Tests.TestCount << " - fused multiply-add\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            using Fixed_128 = FixedBigDecimal<128>;
+            Big_Dec_Std A, B;
+            Big_Dec_Std::from_string((char*)"3.14159265358979323846264338327950288", &A, 200);
+            Big_Dec_Std::from_string((char*)"-0.000271828182845904523536", &B, 200);
+            A.round_to_n_significant_bits(128);
+            B.round_to_n_significant_bits(128);
+            Fixed_128 FA {A}, FB {B};
+
+            Big_Dec_Std RoundTrip;
+            FA.copy_to(&RoundTrip);
+            OK &= RoundTrip.equals_fractional(A);
+
+            Big_Dec_Std Expected;
+            auto Check = [&OK, &Expected](Fixed_128 const& Got) {
+                if (Expected.count_bits() > 128) Expected.round_to_n_significant_bits(128);
+                OK &= Got.equals_fractional(Fixed_128{Expected});
+            };
+            Expected = A; Expected.add_fractional(B); Check(FA + FB);
+            Expected = A; Expected.mul_fractional(B); Check(FA * FB);
+            Expected = A; Expected.div_fractional(B, 300); Check(FA / FB);
+            Expected = A; Expected.sub_fractional(B); Check(FA - FB);
+            OK &= (FA - FA).is_zero();
+
+            //rounding is to even: 1 + 2^-128 is a tie between 1 and 1 + 2^-127
+            Fixed_128 One {1}, HalfUlp;
+            HalfUlp.chunks[0] = 1; HalfUlp.exponent = -128;
+            OK &= (One + HalfUlp).equals_fractional(One);
+            Fixed_128 AboveHalfUlp = HalfUlp + Fixed_128{1.0/1024} * HalfUlp;
+            OK &= (One + AboveHalfUlp).get_least_significant_exponent() == -127;
+
+            OK &= Fixed_128{0.1}.to_double() == 0.1;
+            OK &= Fixed_128{-5}.to_double() == -5.0;
+            OK &= (Fixed_128{1} / Fixed_128{3}).to_double() == 1.0/3.0;
+
+            Fixed_128 Zero {0};
+            Fixed_128 Divided = FA;
+            Divided /= Zero;
+            OK &= Divided.was_divided_by_zero && Divided.equals_fractional(FA);
+
+            //2 to 8 chunks, and a width that leaves the top chunk partly unused
+            OK &= fixed_agrees_with_big_decimal<113>(0x9E37'79B9'7F4A'7C15);
+            OK &= fixed_agrees_with_big_decimal<192>(0x2545'F491'4F6C'DD1D);
+            OK &= fixed_agrees_with_big_decimal<256>(0x1234'5678'9ABC'DEF1);
+            OK &= fixed_agrees_with_big_decimal<320>(0x0F0E'0D0C'0B0A'0908);
+            OK &= fixed_agrees_with_big_decimal<384>(0x5851'F42D'4C95'7F2D);
+            OK &= fixed_agrees_with_big_decimal<448>(0x1405'7B7E'F767'814F);
+            OK &= fixed_agrees_with_big_decimal<512>(0x7FB5'D329'728E'A185);
+
+            //subnormal results of to_double round to even as well
+            Fixed_128 Tiny;
+            Tiny.chunks[0] = 3; Tiny.exponent = -1073; //1.1b * 2^-1073 = 3 * 2^-1074
+            OK &= Tiny.to_double() == std::ldexp(3.0, -1074);
+            Tiny.exponent = -1075; //0.75 * 2^-1074
+            OK &= Tiny.to_double() == std::ldexp(1.0, -1074);
+            Tiny.chunks[0] = 1; Tiny.exponent = -1075; //a tie between 0 and 2^-1074
+            OK &= Tiny.to_double() == 0.0;
+            Tiny.chunks[0] = (1ull << 60) + 1; Tiny.exponent = -1030; Tiny.is_negative = true;
+            OK &= Tiny.to_double() == -std::ldexp(1.0, -1030);
+            OK &= Fixed_128{std::ldexp(5.0, -1074)}.to_double() == std::ldexp(5.0, -1074);
+
+            //infinities come back, NaN decodes as BigDecimal::set_double does it and comes back as an infinity
+            f64 Infinity = std::numeric_limits<f64>::infinity();
+            OK &= Fixed_128{Infinity}.to_double() == Infinity && Fixed_128{-Infinity}.to_double() == -Infinity;
+            OK &= Fixed_128{std::numeric_limits<f64>::quiet_NaN()}.to_double() == Infinity;
+            OK &= (Fixed_128{1e300} * Fixed_128{1e300}).to_double() == Infinity;
+
+            cout << "Test# " << Tests.TestCount << " - fixed precision FixedBigDecimal\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //the same products and shifts with the generic kernels and with the ones picked for this CPU
+            constexpr u32 ChunkCount = 100;
+            ChunkBits BitsA[ChunkCount], BitsB[ChunkCount];
+            for (u32 Idx = 0 ; Idx < ChunkCount ; ++Idx) {
+                BitsA[Idx] = MAX_CHUNK_VAL - Idx * 0x9E3779B97F4A7C15ull;
+                BitsB[Idx] = Idx * 0xC2B2AE3D27D4EB4Full + 1;
+            }
+
+            BigDecimal_::ChunkKernels Detected = BigDecimal_::chunk_kernels();
+            Big_Dec_Std Results[2][3];
+            for (i32 Variant = 0 ; Variant < 2 ; ++Variant) {
+                BigDecimal_::chunk_kernels() = Variant == 0 ? BigDecimal_::ChunkKernels{} : Detected;
+                Big_Dec_Std A {BitsA, ChunkCount}, B {BitsB, ChunkCount};
+                Results[Variant][0] = A;
+                Results[Variant][0].mul_integer(B);
+                Results[Variant][1] = A;
+                Results[Variant][1].shift_left(1000 + 37);
+                Results[Variant][2] = Results[Variant][1];
+                Results[Variant][2].shift_right(37);
+            }
+            BigDecimal_::chunk_kernels() = Detected;
+
+            for (i32 Idx = 0 ; Idx < 3 ; ++Idx) {
+                OK &= Results[0][Idx].equals_integer(Results[1][Idx]);
+            }
+
+            cout << "Test# " << Tests.TestCount << " - generic and CPU specific chunk kernels agree\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //every variant this CPU can run, not just the detected one, pinned one at a time against the generic kernels
+            BigDecimal_::ChunkKernels Generic {};
+            BigDecimal_::ChunkKernels Variants[3] = {};
+            i32 VariantCount = 0;
+#if defined(BIG_DECIMAL_X64_LIMBS)
+            BigDecimal_::CpuFeatures Features = BigDecimal_::cpu_features();
+            if (Features.bmi2 && Features.adx) {
+                Variants[VariantCount++].addmul_chunk = BigDecimal_::addmul_chunk_adx;
+            }
+            if (Features.avx2) {
+                Variants[VariantCount].shift_left_chunks = BigDecimal_::shift_left_chunks_avx2;
+                Variants[VariantCount++].shift_right_chunks = BigDecimal_::shift_right_chunks_avx2;
+            }
+            if (Features.avx512vbmi2) {
+                Variants[VariantCount].shift_left_chunks = BigDecimal_::shift_left_chunks_avx512;
+                Variants[VariantCount++].shift_right_chunks = BigDecimal_::shift_right_chunks_avx512;
+            }
+#endif
+            u64 state = 0x2545'F491'4F6C'DD1D;
+            auto next_random = [&state]() { state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+            constexpr i32 MaxCount = 80;
+            auto Same = [](ChunkBits const *X, ChunkBits const *Y, i32 Count) {
+                for (i32 Idx = 0 ; Idx < Count ; ++Idx) if (X[Idx] != Y[Idx]) return false;
+                return true;
+            };
+
+            BigDecimal_::ChunkKernels Detected = BigDecimal_::chunk_kernels();
+            for (i32 Variant = 0 ; Variant < VariantCount ; ++Variant) {
+                BigDecimal_::ChunkKernels const& Kernels = Variants[Variant];
+                for (i32 Round = 0 ; Round < 300 ; ++Round) {
+                    i32 Count = 1 + static_cast<i32>(next_random() % MaxCount);
+                    u32 Offset = static_cast<u32>(next_random() % CHUNK_WIDTH);
+                    ChunkBits B = next_random();
+                    ChunkBits Src[MaxCount], Dst[MaxCount], Expected[MaxCount], Got[MaxCount];
+                    for (i32 Idx = 0 ; Idx < Count ; ++Idx) {
+                        Src[Idx] = next_random() >> (next_random() % 4 == 0 ? 32 : 0);
+                        Dst[Idx] = next_random();
+                    }
+
+                    //shifts into another array and in place
+                    OK &= Generic.shift_left_chunks(Expected, Src, Count, Offset) == Kernels.shift_left_chunks(Got, Src, Count, Offset);
+                    OK &= Same(Expected, Got, Count);
+                    BigDecimal_::copy_chunks(Got, Src, Count);
+                    Kernels.shift_left_chunks(Got, Got, Count, Offset);
+                    OK &= Same(Expected, Got, Count);
+                    OK &= Generic.shift_right_chunks(Expected, Src, Count, Offset) == Kernels.shift_right_chunks(Got, Src, Count, Offset);
+                    OK &= Same(Expected, Got, Count);
+                    BigDecimal_::copy_chunks(Got, Src, Count);
+                    Kernels.shift_right_chunks(Got, Got, Count, Offset);
+                    OK &= Same(Expected, Got, Count);
+
+                    //multiply, multiply-add and multiply-subtract rows
+                    OK &= Generic.mul_chunk(Expected, Src, Count, B) == Kernels.mul_chunk(Got, Src, Count, B);
+                    OK &= Same(Expected, Got, Count);
+                    BigDecimal_::copy_chunks(Expected, Dst, Count);
+                    BigDecimal_::copy_chunks(Got, Dst, Count);
+                    OK &= Generic.addmul_chunk(Expected, Src, Count, B) == Kernels.addmul_chunk(Got, Src, Count, B);
+                    OK &= Same(Expected, Got, Count);
+                    OK &= Generic.submul_chunk(Expected, Src, Count, B) == Kernels.submul_chunk(Got, Src, Count, B);
+                    OK &= Same(Expected, Got, Count);
+                }
+
+                //long additions, subtractions, shifts and products through the pinned table
+                for (i32 Round = 0 ; Round < 20 ; ++Round) {
+                    ChunkBits BitsA[MaxCount], BitsB[MaxCount];
+                    u32 CountA = 16 + static_cast<u32>(next_random() % (MaxCount - 16));
+                    u32 CountB = 16 + static_cast<u32>(next_random() % (MaxCount - 16));
+                    for (u32 Idx = 0 ; Idx < MaxCount ; ++Idx) {
+                        BitsA[Idx] = next_random();
+                        BitsB[Idx] = next_random();
+                    }
+                    BitsA[CountA-1] |= 0x1;
+                    BitsB[CountB-1] |= 0x1;
+                    u32 Shift = static_cast<u32>(next_random() % (4 * CHUNK_WIDTH));
+                    Big_Dec_Std Results[2][3];
+                    for (i32 Pinned = 0 ; Pinned < 2 ; ++Pinned) {
+                        BigDecimal_::chunk_kernels() = Pinned == 0 ? Generic : Kernels;
+                        Big_Dec_Std A {BitsA, CountA, Round % 2 == 1}, B {BitsB, CountB, Round % 3 == 1};
+                        A.shift_left(Shift);
+                        Results[Pinned][0] = A;
+                        Results[Pinned][0].add_integer_signed(B);
+                        Results[Pinned][1] = A;
+                        Results[Pinned][1].sub_integer_signed(B);
+                        Results[Pinned][1].shift_right(Shift / 2 + 1);
+                        Results[Pinned][2] = A;
+                        Results[Pinned][2].mul_integer(B);
+                    }
+                    for (i32 Idx = 0 ; Idx < 3 ; ++Idx) {
+                        OK &= Results[0][Idx].equals_integer(Results[1][Idx]) && Results[0][Idx].is_negative == Results[1][Idx].is_negative;
+                    }
+                }
+            }
+            BigDecimal_::chunk_kernels() = Detected;
+
+            cout << "Test# " << Tests.TestCount << " - each kernel variant of this CPU against the generic kernels (" << VariantCount << " variants)\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //shifts by whole chunks move the chunks without touching the bits, shifting back restores the value
+            constexpr u32 ChunkCount = 40;
+            ChunkBits Bits[ChunkCount];
+            for (u32 Idx = 0 ; Idx < ChunkCount ; ++Idx) {
+                Bits[Idx] = Idx * 0x9E3779B97F4A7C15ull + 1;
+            }
+            ChunkBits PowerBits[4] = {0x0, 0x0, 0x0, 0x1};
+
+            Big_Dec_Std A {Bits, ChunkCount}, Power {PowerBits, 4};
+            Big_Dec_Std Shifted = A;
+            Shifted.shift_left(3 * CHUNK_WIDTH);
+            Big_Dec_Std Product = A;
+            Product.mul_integer(Power);
+            OK &= Shifted.equals_integer(Product) && Shifted.length == ChunkCount + 3;
+
+            Shifted.shift_right(3 * CHUNK_WIDTH);
+            OK &= Shifted.equals_integer(A);
+
+            Shifted.shift_right(ChunkCount * CHUNK_WIDTH - CHUNK_WIDTH);
+            OK &= Shifted.length == 1 && Shifted.chunks[0] == Bits[ChunkCount-1];
+
+            cout << "Test# " << Tests.TestCount << " - shifts by whole chunks\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //fractional arithmetic leaves trailing zero bits in place, comparison, rounding and normalize() see through them
+            Big_Dec_Std Three, Five, Six, Ten, Eight, Sixty, Max, One;
+            Big_Dec_Std::from_string((char*)"3", &Three);
+            Big_Dec_Std::from_string((char*)"5", &Five);
+            Big_Dec_Std::from_string((char*)"6", &Six);
+            Big_Dec_Std::from_string((char*)"10", &Ten);
+            Big_Dec_Std::from_string((char*)"8", &Eight);
+            Big_Dec_Std::from_string((char*)"60", &Sixty);
+            Big_Dec_Std::from_string((char*)"18446744073709551615", &Max);
+            Big_Dec_Std::from_string((char*)"1", &One);
+
+            Big_Dec_Std Sum = Three;
+            Sum.add_fractional(Five);
+            OK &= Sum.is_fractional() && !Sum.is_normalized_fractional();
+            OK &= Sum.equals_fractional(Eight) && Eight.equals_fractional(Sum) && Sum.exponent == 3;
+
+            Big_Dec_Std Product = Six;
+            Product.mul_fractional(Ten);
+            OK &= Product.is_fractional() && Product.equals_fractional(Sixty) && Product.exponent == 5;
+            OK &= !Product.equals_fractional(Eight);
+
+            Product.normalize();
+            OK &= Product.is_normalized_fractional() && Product.equal_bits(Sixty);
+
+            //a carry into a new chunk leaves only zero chunks below, those are dropped
+            Big_Dec_Std Carried = Max;
+            Carried.add_fractional(One);
+            OK &= Carried.length == 1 && Carried.chunks[0] == 0x1 && Carried.exponent == 64;
+
+            Sum.round_to_n_significant_bits(1);
+            OK &= Sum.equals_fractional(Eight) && Sum.is_normalized_fractional();
+
+            cout << "Test# " << Tests.TestCount << " - lazy normalization of fractional results\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //results rounded to the rounding context while they are computed, the same as exact results rounded afterwards
+            using BigDecimal_::RoundingContext;
+            using BigDecimal_::RoundingMode;
+            Big_Dec_Std::Workspace& ws = Big_Dec_Std::workspace();
+            Big_Dec_Std One, Three, Tenth, Huge;
+            Big_Dec_Std::from_string((char*)"1", &One);
+            Big_Dec_Std::from_string((char*)"3", &Three);
+            Big_Dec_Std::from_string((char*)"0.1", &Tenth);
+            Huge.set(1u, false, 3000);
+
+            Big_Dec_Std Exact = One;
+            Exact.div_fractional(Three, ws, RoundingContext{}, 200);
+            for (RoundingMode Mode : {RoundingMode::NEAREST_EVEN, RoundingMode::TOWARD_ZERO, RoundingMode::UP, RoundingMode::DOWN, RoundingMode::AWAY}) {
+                Big_Dec_Std Third = One;
+                Third.div_fractional(Three, ws, RoundingContext{53, Mode});
+                Big_Dec_Std Expected = Exact;
+                Expected.round_to_n_significant_bits(53, Mode, ws);
+                OK &= Third.equals_fractional(Expected) && Third.count_bits() <= 53;
+            }
+
+            Big_Dec_Std Up = One, Down = One;
+            Up.div_fractional(Three, ws, RoundingContext{24, RoundingMode::UP});
+            Down.div_fractional(Three, ws, RoundingContext{24, RoundingMode::TOWARD_ZERO});
+            OK &= Up.to_float() == 1.f/3.f && Down.to_float() < Up.to_float();
+
+            //below zero UP truncates the magnitude and DOWN rounds it up
+            Big_Dec_Std MinusOne = One;
+            MinusOne.is_negative = true;
+            Big_Dec_Std NegativeExact = MinusOne;
+            NegativeExact.div_fractional(Three, ws, RoundingContext{}, 200);
+            for (RoundingMode Mode : {RoundingMode::NEAREST_EVEN, RoundingMode::TOWARD_ZERO, RoundingMode::UP, RoundingMode::DOWN, RoundingMode::AWAY}) {
+                Big_Dec_Std Third = MinusOne;
+                Third.div_fractional(Three, ws, RoundingContext{53, Mode});
+                Big_Dec_Std Expected = NegativeExact;
+                Expected.round_to_n_significant_bits(53, Mode, ws);
+                OK &= Third.equals_fractional(Expected) && Third.count_bits() <= 53 && Third.is_negative;
+            }
+            Big_Dec_Std NegativeUp = MinusOne, NegativeDown = MinusOne, NegativeTruncated = MinusOne;
+            NegativeUp.div_fractional(Three, ws, RoundingContext{24, RoundingMode::UP});
+            NegativeDown.div_fractional(Three, ws, RoundingContext{24, RoundingMode::DOWN});
+            NegativeTruncated.div_fractional(Three, ws, RoundingContext{24, RoundingMode::TOWARD_ZERO});
+            OK &= NegativeDown.to_float() == -1.f/3.f && NegativeUp.to_float() > NegativeDown.to_float();
+            OK &= NegativeUp.equals_fractional(NegativeTruncated) && NegativeUp.to_float() == -Down.to_float();
+
+            //0.1 is far below the last bit of 2^3000, it only decides the direction
+            Big_Dec_Std Sum = Huge;
+            Sum.add_fractional(Tenth, ws, RoundingContext{53, RoundingMode::TOWARD_ZERO});
+            OK &= Sum.equals_fractional(Huge);
+            Sum = Huge;
+            Sum.add_fractional(Tenth, ws, RoundingContext{53, RoundingMode::AWAY});
+            OK &= Sum.count_bits() == 53 && Sum.exponent == 3000;
+            Sum = Huge;
+            Sum.sub_fractional(Tenth, ws, RoundingContext{53, RoundingMode::TOWARD_ZERO});
+            OK &= Sum.count_bits() == 53 && Sum.exponent == 2999;
+
+            Big_Dec_Std MinusHuge = Huge;
+            MinusHuge.is_negative = true;
+            Sum = MinusHuge;
+            Sum.add_fractional(Tenth, ws, RoundingContext{53, RoundingMode::UP});
+            OK &= Sum.is_negative && Sum.count_bits() == 53 && Sum.exponent == 2999;
+            Sum = MinusHuge;
+            Sum.add_fractional(Tenth, ws, RoundingContext{53, RoundingMode::DOWN});
+            OK &= Sum.equals_fractional(MinusHuge);
+            Sum = MinusHuge;
+            Sum.sub_fractional(Tenth, ws, RoundingContext{53, RoundingMode::UP});
+            OK &= Sum.equals_fractional(MinusHuge);
+            Sum = MinusHuge;
+            Sum.sub_fractional(Tenth, ws, RoundingContext{53, RoundingMode::DOWN});
+            OK &= Sum.is_negative && Sum.count_bits() == 53 && Sum.exponent == 3000;
+            Sum = MinusHuge;
+            Sum.sub_fractional(Tenth, ws, RoundingContext{53, RoundingMode::TOWARD_ZERO});
+            OK &= Sum.equals_fractional(MinusHuge);
+
+            //the thread's context applies to the overloads without one, and to the expression operators
+            Big_Dec_Std::rounding_context() = RoundingContext{24, RoundingMode::NEAREST_EVEN};
+            Big_Dec_Std Quotient = One / Three;
+            Big_Dec_Std::rounding_context() = RoundingContext{};
+            OK &= Quotient.to_double() == static_cast<f64>(1.f/3.f);
+
+            //the fused a*b - c rounds once, in the direction of the context, for either sign of the result
+            Big_Dec_Std Thirtieth = One;
+            Thirtieth.div_fractional(Three, ws, RoundingContext{}, 200);
+            Thirtieth.mul_fractional(Tenth, ws);
+            Big_Dec_Std *Addends[] = {&One, &Thirtieth, &MinusOne};
+            for (RoundingMode Mode : {RoundingMode::UP, RoundingMode::DOWN}) {
+                for (Big_Dec_Std *C : Addends) {
+                    Big_Dec_Std MinusC = *C, Expected, Flipped;
+                    MinusC.neg();
+                    fma(Tenth, Three, MinusC, Expected);
+                    Expected.round_to_n_significant_bits(30, Mode, ws);
+                    fma(Tenth, Three, *C, Flipped);
+                    Flipped.round_to_n_significant_bits(30, Mode, ws);
+                    Big_Dec_Std::rounding_context() = RoundingContext{30, Mode};
+                    Big_Dec_Std Difference = Tenth * Three - *C;
+                    Big_Dec_Std Sum = Tenth * Three + *C;
+                    Big_Dec_Std::rounding_context() = RoundingContext{};
+                    OK &= Difference.equals_fractional(Expected) && Difference.count_bits() <= 30;
+                    OK &= Sum.equals_fractional(Flipped);
+                }
+            }
+
+            cout << "Test# " << Tests.TestCount << " - rounding context of the fractional arithmetic\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //conversions round to nearest even from the top chunks, with a sticky bit for everything further down
+            Big_Dec_Std Value;
+            ChunkBits Tie[] = {(1ull << 10) | (1ull << 63)};
+            Value.set(Tie, 1u, false, 63);
+            OK &= Value.to_double() == std::ldexp(1.0, 63); //exactly halfway, stays even
+            ChunkBits TieOdd[] = {(1ull << 10) | (1ull << 11) | (1ull << 63)};
+            Value.set(TieOdd, 1u, false, 63);
+            OK &= Value.to_double() == std::ldexp(1.0, 63) + std::ldexp(1.0, 12); //halfway above an odd bit, rounds up
+
+            //the tie is broken by a single bit three chunks below the top one
+            ChunkBits Sticky[] = {1, 0, 0, (1ull << 10) | (1ull << 63)};
+            Value.set(Sticky, 4u, true, 0);
+            OK &= Value.to_double() == -(1.0 + std::ldexp(1.0, -52));
+
+            //all 64 bits set carries into the next exponent, and past the largest finite into infinity
+            ChunkBits Ones[] = {~0ull};
+            Value.set(Ones, 1u, false, 10);
+            OK &= Value.to_double() == 2048.0 && Value.to_float() == 2048.f;
+            Value.exponent = 1023;
+            OK &= std::isinf(Value.to_double()) && Value.to_float() == std::numeric_limits<f32>::infinity();
+            Value.exponent = 1024;
+            Value.is_negative = true;
+            OK &= Value.to_double() == -std::numeric_limits<f64>::infinity();
+
+            //subnormals keep fewer bits, below half the smallest one the result is a signed zero
+            ChunkBits Three[] = {3};
+            Value.set(Three, 1u, false, -1074);
+            OK &= Value.to_double() == std::ldexp(1.0, -1073); //1.1b * 2^-1074 is halfway, rounds to the even 2^-1073
+            Value.exponent = -1075;
+            OK &= Value.to_double() == std::numeric_limits<f64>::denorm_min();
+            ChunkBits One[] = {1};
+            Value.set(One, 1u, true, -1075);
+            OK &= Value.to_double() == 0.0 && std::signbit(Value.to_double());
+            Value.set(One, 1u, false, -149);
+            OK &= Value.to_float() == std::numeric_limits<f32>::denorm_min();
+
+            cout << "Test# " << Tests.TestCount << " - to_double and to_float read only the top chunks\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //fractionals ordered by sign, then exponent, then chunks from the top
+            constexpr i32 COUNT = 8;
+            Big_Dec_Std Ascending[COUNT];
+            const char *Strings[COUNT] = {"-3", "-1.5", "-0.1", "0", "0.1", "1", "1.5", "123456789012345678901234567890.5"};
+            for (i32 Idx = 0 ; Idx < COUNT ; ++Idx) Big_Dec_Std::from_string((char*)Strings[Idx], &Ascending[Idx]);
+            for (i32 Idx = 0 ; Idx < COUNT ; ++Idx) {
+                for (i32 Jdx = 0 ; Jdx < COUNT ; ++Jdx) {
+                    OK &= (compare(Ascending[Idx], Ascending[Jdx]) == (Idx <=> Jdx));
+                    OK &= (Ascending[Idx] < Ascending[Jdx]) == (Idx < Jdx) && (Ascending[Idx] == Ascending[Jdx]) == (Idx == Jdx);
+                }
+            }
+
+            //same exponent, the leading 1s sit at different bits of the top chunk, the longer one only differs far down
+            ChunkBits Short[] = {0b1011};
+            ChunkBits Long[] = {0x1, 0x0, 0b1011ull << 60};
+            Big_Dec_Std A, B;
+            A.set(Short, 1u, false, 5);
+            B.set(Long, 3u, false, 5);
+            OK &= A < B && B > A;
+            A.is_negative = B.is_negative = true;
+            OK &= A > B;
+
+            //trailing zero bits left by lazy normalization don't change the value
+            ChunkBits Lazy[] = {0b1011ull << 20};
+            B.set(Lazy, 1u, true, 5);
+            OK &= compare(A, B) == std::strong_ordering::equal;
+
+            //-0 and +0 are the same value, only equals_fractional tells them apart
+            A.zero(Big_Dec_Std::ZERO_EVERYTHING);
+            B.zero(Big_Dec_Std::ZERO_EVERYTHING);
+            B.is_negative = true;
+            OK &= A == B && !(A < B) && !(B < A);
+            OK &= !A.equals_fractional(B) && !B.equals_fractional(A);
+
+            FixedBigDecimal<128> FixedA = 1.5, FixedB = -2.0;
+            OK &= FixedB < FixedA && FixedA == FixedBigDecimal<128>{1.5} && FixedBigDecimal<128>{} > FixedB;
+
+            cout << "Test# " << Tests.TestCount << " - three-way compare of fractionals\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //freed blocks go back to the free list of their size class and are handed out again
+            memory_index PoolSize = Kilobytes(256);
+            PoolAlloc<ChunkBits> Pool {PoolSize, new u8[PoolSize](), deleter_std};
+            ChunkBits *Five = Pool.allocate(5);
+            Pool.deallocate(Five, 5);
+            OK &= Pool.allocate(8) == Five; //5 and 8 chunks are both in the 64 byte class
+            ChunkBits *Nine = Pool.allocate(9);
+            OK &= Nine != Five;
+            Pool.deallocate(Nine, 9);
+            Pool.deallocate(Five, 8);
+
+            using BigDec_Pool = BigDecimal<PoolAlloc<ChunkBits>>;
+            BigDec_Pool::initialize_context(Pool);
+            //values that keep growing and dying stop taking new memory once every size class has been used
+            memory_index UsedAfterWarmup = 0;
+            for (i32 Round = 0 ; Round < 200 ; ++Round) {
+                BigDec_Pool A {Pool, 0}, B {Pool, 0};
+                ChunkBits Bits[32];
+                for (i32 Idx = 0 ; Idx < 32 ; ++Idx) Bits[Idx] = 0x9E37'79B9'7F4A'7C15 * (Idx + Round + 1) | 0x1;
+                A.set(Bits, 1u + Round % 32, false, 3);
+                B.set(Bits, 32u - Round % 32, false, 1);
+                A.mul_fractional(B);
+                A.add_fractional(B);
+                if (Round == 100) UsedAfterWarmup = Pool.meta->arena.Used;
+            }
+            OK &= Pool.meta->arena.Used == UsedAfterWarmup;
+
+            //a workspace on a pool of its own starts over empty, free lists included
+            PoolAlloc<ChunkBits> WorkspacePool {PoolSize, new u8[PoolSize](), deleter_std};
+            {
+                BigDec_Pool::Workspace ws {WorkspacePool};
+                BigDec_Pool A {Pool, 0};
+                A.set(7);
+                A.normalize();
+                A.div_fractional(A, ws, 500);
+                ws.reset();
+                OK &= WorkspacePool.meta->arena.Used == sizeof(ArenaAllocMeta);
+                for (void *List : WorkspacePool.meta->free_lists) OK &= List == nullptr;
+            }
+            BigDec_Pool::close_context(true);
+
+            cout << "Test# " << Tests.TestCount << " - pooled allocator recycles chunk arrays\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //a full arena continues in overflow blocks, checkpoints and LIFO frees give memory back, the high water stays
+            memory_index SmallSize = sizeof(ArenaAllocMeta) + Kilobytes(1);
+            ArenaAlloc<ChunkBits> Small {SmallSize, new u8[SmallSize](), deleter_std};
+            ArenaAllocMeta *Meta = Small.meta;
+
+            ChunkBits *First = Small.allocate(16);
+            Small.deallocate(First, 16);
+            OK &= Meta->arena.Used == sizeof(ArenaAllocMeta) && Small.allocate(16) == First;
+            ChunkBits *Second = Small.allocate(16);
+            Small.deallocate(First, 16); //not the most recent one, stays
+            OK &= Meta->bytes_used() == sizeof(ArenaAllocMeta) + 2 * 16 * sizeof(ChunkBits);
+
+            ArenaCheckpoint Checkpoint = Meta->checkpoint();
+            memory_index UsedAtCheckpoint = Meta->bytes_used();
+            {
+                ArenaScope Scope {Meta};
+                ChunkBits *Big = Small.allocate(512);
+                Big[511] = 0x1;
+                OK &= Meta->overflow != nullptr && Meta->bytes_used() == UsedAtCheckpoint + 512 * sizeof(ChunkBits);
+                Small.allocate(512);
+                OK &= Meta->overflow->Parent != nullptr;
+            }
+            OK &= Meta->overflow == nullptr && Meta->bytes_used() == UsedAtCheckpoint;
+            OK &= Meta->high_water == UsedAtCheckpoint + 2 * 512 * sizeof(ChunkBits);
+
+            Small.allocate(512);
+            Meta->restore(Checkpoint);
+            OK &= Meta->overflow == nullptr && Meta->bytes_used() == UsedAtCheckpoint && Second[15] == 0x0;
+
+            Small.allocate(512);
+            Meta->reset();
+            OK &= Meta->overflow == nullptr && Meta->bytes_used() == sizeof(ArenaAllocMeta);
+            OK &= Meta->high_water == UsedAtCheckpoint + 2 * 512 * sizeof(ChunkBits);
+
+            //temporaries that die in reverse order of their birth leave the arena as it was
+            BigDec_Arena Seven {Small, 7};
+            memory_index UsedBefore = Meta->bytes_used();
+            for (i32 Round = 0 ; Round < 50 ; ++Round) {
+                BigDec_Arena Product {Small, Seven};
+                ChunkBits Bits[40] = {};
+                Bits[39] = 0x1;
+                Product.set(Bits, 40u);
+            }
+            OK &= Meta->bytes_used() == UsedBefore;
+
+            //a temporary from before a scope that dies inside it leaves the scope's overflow block in place
+            {
+                ArenaAlloc<ChunkBits> Tiny {SmallSize, new u8[SmallSize](), deleter_std};
+                Tiny.allocate(128); //fills the arena
+                ChunkBits *Before = Tiny.allocate(16);
+                memory_arena *Block = Tiny.meta->overflow;
+                {
+                    ArenaScope Scope {Tiny.meta};
+                    Tiny.deallocate(Before, 16);
+                    OK &= Tiny.meta->overflow == Block && Block->Used == 0;
+                    Tiny.allocate(512)[511] = 0x1;
+                    OK &= Tiny.meta->overflow != Block;
+                }
+                OK &= Tiny.meta->overflow == Block && Tiny.meta->bytes_used() == SmallSize + 16 * sizeof(ChunkBits);
+                Tiny.deallocate(Before, 16); //no scope left, the empty block goes
+                OK &= Tiny.meta->overflow == nullptr && Tiny.meta->bytes_used() == SmallSize;
+            }
+
+            //restoring a checkpoint keeps the recycled blocks from below it
+            {
+                PoolAlloc<ChunkBits> Pool {SmallSize, new u8[SmallSize](), deleter_std};
+                ChunkBits *Below = Pool.allocate(5);
+                Pool.deallocate(Below, 5);
+                {
+                    ArenaScope Scope {Pool.meta};
+                    ChunkBits *Above = Pool.allocate(9);
+                    Pool.deallocate(Above, 9);
+                }
+                OK &= Pool.meta->free_lists[PoolSizeClass(9 * sizeof(ChunkBits))] == nullptr;
+                OK &= Pool.allocate(8) == Below;
+            }
+
+            cout << "Test# " << Tests.TestCount << " - arena overflow blocks, checkpoints and LIFO free\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //storage reserved once is enough for everything that grows into it, shrink_to_fit gives the rest back
+            Big_Dec_Std Sum, Expected;
+            Sum.set(1);
+            Sum.reserve_bits(64 * 20 + 1);
+            OK &= Sum.m_chunks_capacity >= 21 && Sum.length == 1 && Sum.chunks[0] == 1;
+            ChunkBits *Reserved = Sum.chunks;
+            for (i32 Idx = 0 ; Idx < 20 ; ++Idx) {
+                Sum.shift_left(CHUNK_WIDTH);
+                Sum.add_integer_unsigned(Sum);
+            }
+            OK &= Sum.chunks == Reserved && Sum.length == 21;
+
+            ChunkBits ExpectedBits[21] = {};
+            ExpectedBits[20] = 1ull << 20; //each round moves up a chunk and doubles
+            Expected.set(ExpectedBits, 21u);
+            OK &= Sum.equals_integer(Expected);
+
+            Sum.shrink_to_fit();
+            OK &= Sum.m_chunks_capacity == 21 && Sum.equals_integer(Expected);
+            Sum.set(5);
+            Sum.shrink_to_fit();
+            OK &= Sum.m_chunks_capacity == Big_Dec_Std::INLINE_CHUNKS_COUNT && Sum.chunks[0] == 5;
+
+            //in an arena the block stays where it is, the top goes back only while it is the latest allocation
+            {
+                size_t arena_size = Kilobytes(4);
+                ArenaChunkAlloc Arena {arena_size, new u8[arena_size](), deleter_std};
+                BigDec_Arena Latest {Arena, 0u}, Below {Arena, 0u};
+                Below.reserve_limbs(10);
+                Latest.reserve_limbs(10);
+                ChunkBits ThreeChunks[3] = {1, 2, 3};
+                Below.set(ThreeChunks, 3u);
+                Latest.set(ThreeChunks, 3u);
+                ChunkBits *LatestChunks = Latest.chunks;
+                memory_index UsedBefore = Arena.meta->arena.Used;
+                Latest.shrink_to_fit();
+                OK &= Latest.chunks == LatestChunks && Latest.m_chunks_capacity == 3;
+                OK &= Arena.meta->arena.Used == UsedBefore - 7 * sizeof(ChunkBits);
+                Below.shrink_to_fit();
+                OK &= Below.m_chunks_capacity == 10 && Arena.meta->arena.Used == UsedBefore - 7 * sizeof(ChunkBits);
+                OK &= Latest.equals_integer(Below) && Below.count_bits() == 64 * 2 + 2;
+            }
+
+            Big_Dec_Std Copy;
+            Copy.reserve_limbs(4);
+            ChunkBits *CopyChunks = Copy.chunks;
+            Copy = Expected; //too long for the reservation, grows once
+            OK &= Copy.chunks != CopyChunks && Copy.equals_integer(Expected);
+
+            cout << "Test# " << Tests.TestCount << " - reserving and shrinking storage\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            using BigDecimal_::RoundingContext;
+            using BigDecimal_::RoundingMode;
+            Big_Dec_Std::Workspace& ws = Big_Dec_Std::workspace();
+            RoundingContext Exact {};
+            RoundingContext Single {24, RoundingMode::NEAREST_EVEN};
+            Big_Dec_Std A, B;
+
+            A.set_double(1.5); B.set_double(2.25);
+            A.add_fractional(B, ws, Exact);
+            OK &= A.to_double() == 3.75;
+            A.set_double(1.5);
+            A.sub_fractional(B, ws, Exact);
+            OK &= A.to_double() == -0.75 && A.is_negative;
+            A.set_double(-1.5);
+            A.mul_fractional(B, ws, Exact);
+            OK &= A.to_double() == -3.375;
+            A.set_double(7.0); B.set_double(-2.0);
+            A.div_fractional(B, ws, Single);
+            OK &= A.to_double() == -3.5;
+            A.set_double(1.0); B.set_double(3.0);
+            A.div_fractional(B, ws, Single);
+            OK &= A.to_float() == 1.f / 3.f && A.count_bits() <= 24;
+
+            //results that outgrow the chunk carry into a second one
+            A.set(~0ull); B.set(1u, false, -63);
+            A.add_fractional(B, ws, Exact);
+            OK &= A.length == 1 && A.chunks[0] == 0x1 && A.exponent == 1;
+            A.set(~0ull); B.set(1u, false, -100);
+            A.add_fractional(B, ws, Exact);
+            OK &= A.length == 2 && A.count_bits() == 101 && A.exponent == 0;
+            A.set(~0ull); B.set(~0ull);
+            A.mul_fractional(B, ws, Exact);
+            OK &= A.length == 2 && A.count_bits() == 128 && A.exponent == 1;
+
+            //cancellation leaves +0
+            A.set_double(-0.1); B.set_double(-0.1);
+            A.sub_fractional(B, ws, Exact);
+            OK &= A.is_zero() && !A.is_negative && A.exponent == 0;
+
+            //set_double and set_float keep the sign and decode subnormals
+            A.set_double(-0.1);
+            OK &= A.is_negative && A.to_double() == -0.1;
+            A.set_float(1e-45f);
+            OK &= A.exponent == -149 && A.to_float() == 1e-45f;
+
+            //two chunk operands
+            ChunkBits Wide[2] = {0x1, ~0ull};
+            A.set(Wide, 2, false, 0); B.set(Wide, 2, false, 0);
+            A.add_fractional(B, ws, Exact);
+            OK &= A.length == 3 && A.count_bits() == 129 && A.exponent == 1; //the doubled mantissa keeps a trailing zero bit
+            A.set(Wide, 2, false, 0); B.set(1u, false, -130);
+            A.add_fractional(B, ws, Exact);
+            OK &= A.length == 3 && A.count_bits() == 131 && A.exponent == 0;
+            A.set(Wide, 2, false, 0); B.set(Wide, 2, true, -1);
+            A.sub_fractional(B, ws, Exact);
+            OK &= A.length == 3 && A.count_bits() == 130 && A.exponent == 1 && !A.is_negative;
+            A.set(Wide, 2, false, 0); B.set(Wide, 2, true, 0);
+            A.mul_fractional(B, ws, Exact);
+            OK &= A.length == 4 && A.count_bits() == 256 && A.exponent == 1 && A.is_negative;
+            A.set(Wide, 2, false, 0); B.set(3u, false, 1);
+            A.div_fractional(B, ws, RoundingContext{100});
+            OK &= A.length == 1 && A.chunks[0] == 0x5555'5555'5555'5555 && A.exponent == -1; //0x5555...5555'0000...0000.0101... rounded to 100 bits
+
+            cout << "Test# " << Tests.TestCount << " - one and two chunk fast paths\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
+        {
+            OK = true;
+            //the fractional arithmetic at precision 53 against the FPU, in all four IEEE rounding modes and on signed operands
+            using BigDecimal_::RoundingContext;
+            using BigDecimal_::RoundingMode;
+            Big_Dec_Std::Workspace& ws = Big_Dec_Std::workspace();
+            u64 state = 0x9E37'79B9'7F4A'7C15;
+            auto next_random = [&state]() { state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+            auto random_double = [&next_random]() {
+                f64 Mantissa = static_cast<f64>(next_random() >> 11 | 1ull << 52) * 0x1p-52;
+                return (next_random() & 0x1 ? -1.0 : 1.0) * std::ldexp(Mantissa, static_cast<i32>(next_random() % 120) - 60);
+            };
+            RoundingMode Modes[4] = {RoundingMode::NEAREST_EVEN, RoundingMode::TOWARD_ZERO, RoundingMode::UP, RoundingMode::DOWN};
+            int FpuModes[4] = {FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD};
+            int OldFpuMode = std::fegetround();
+            i32 Mismatches = 0;
+            for (i32 Mode = 0 ; Mode < 4 ; ++Mode) {
+                RoundingContext Rounding {53, Modes[Mode]};
+                for (i32 Round = 0 ; Round < 20000 ; ++Round) {
+                    volatile f64 X = random_double();
+                    volatile f64 Y = Round % 8 == 0 ? X * (1.0 + 0x1p-50 * static_cast<f64>(next_random() % 8)) : random_double();
+                    std::fesetround(FpuModes[Mode]);
+                    volatile f64 Expected[4] = {X + Y, X - Y, X * Y, X / Y};
+                    std::fesetround(OldFpuMode);
+                    for (i32 Op = 0 ; Op < 4 ; ++Op) {
+                        Big_Dec_Std A, B;
+                        A.set_double(X);
+                        B.set_double(Y);
+                        if (Op == 0) A.add_fractional(B, ws, Rounding);
+                        if (Op == 1) A.sub_fractional(B, ws, Rounding);
+                        if (Op == 2) A.mul_fractional(B, ws, Rounding);
+                        if (Op == 3) A.div_fractional(B, ws, Rounding);
+                        if (A.to_double() != Expected[Op]) ++Mismatches;
+                    }
+                }
+            }
+            OK &= Mismatches == 0;
+
+            cout << "Test# " << Tests.TestCount << " - fractional arithmetic at precision 53 agrees with the FPU in all rounding modes\n";
+            cout << ( OK ? "PASSED" : "ERROR" ) << "\n";
+
+            Tests.Append(OK);
+        }
+
         {
             //finished with all the tests
             BigDec_Arena::close_context(true);
@@ -2746,6 +3970,54 @@ int Test_variable_chunkment_size(bool only_errors=false) {
         Tests.Append(OK);
     }
 
+    {
+        //NOTE(##2026 10 18): the limb primitives of this build (see BIG_DECIMAL_PORTABLE_LIMBS) against FullMulN
+        //and against sums and differences of the 32 bit halves, on edge values and random ones
+        u64 state = 0xD1B5'4A32'D192'ED03;
+        auto next_random = [&state]() { state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+        ChunkBits Edges[] = {0x0, 0x1, 0x2, 0xFFFF'FFFF, 0x1'0000'0000, 0x7FFF'FFFF'FFFF'FFFF, 0x8000'0000'0000'0000, ~0ull - 1, ~0ull};
+        constexpr i32 EDGES_COUNT = sizeof(Edges) / sizeof(Edges[0]);
+        ChunkBits const LOW_HALF = 0xFFFF'FFFF;
+
+        OK = true;
+        for (i32 Round = 0 ; Round < EDGES_COUNT * EDGES_COUNT + 10000 ; ++Round) {
+            bool IsEdge = Round < EDGES_COUNT * EDGES_COUNT;
+            ChunkBits A = IsEdge ? Edges[Round / EDGES_COUNT] : next_random();
+            ChunkBits B = IsEdge ? Edges[Round % EDGES_COUNT] : next_random();
+
+            ChunkBits Prod[2], Expected[2];
+            BigDecimal_::full_mul_chunk(A, B, Prod);
+            FullMulN<ChunkBits>(A, B, Expected);
+            OK &= Prod[0] == Expected[0] && Prod[1] == Expected[1];
+
+            for (ChunkBits Carry = 0 ; Carry < 2 ; ++Carry) {
+                ChunkBits Low  = (A & LOW_HALF) + (B & LOW_HALF) + Carry;
+                ChunkBits High = (A >> 32) + (B >> 32) + (Low >> 32);
+                ChunkBits Sum;
+                OK &= BigDecimal_::add_carry(Carry, A, B, &Sum) == High >> 32;
+                OK &= Sum == (High << 32 | (Low & LOW_HALF));
+
+                ChunkBits Borrow = Carry;
+                Low  = (A & LOW_HALF) - (B & LOW_HALF) - Borrow;
+                High = (A >> 32) - (B >> 32) - (Low >> 63);
+                ChunkBits Difference;
+                OK &= BigDecimal_::sub_borrow(Borrow, A, B, &Difference) == High >> 63;
+                OK &= Difference == (High << 32 | (Low & LOW_HALF));
+            }
+        }
+
+        if (!only_errors || !OK) {
+            cout << "Test #" << Tests.TestCount << "\n";
+#if defined(BIG_DECIMAL_PORTABLE_LIMBS)
+            cout << "portable limb primitives: full_mul_chunk, add_carry and sub_borrow\n";
+#else
+            cout << "limb primitives: full_mul_chunk, add_carry and sub_borrow\n";
+#endif
+            cout << (OK ? "OK" : "ERROR") << "\n";
+        }
+        Tests.Append(OK);
+    }
+
 
 
     {
@@ -2970,10 +4242,8 @@ int Test_variable_chunkment_size(bool only_errors=false) {
         }
         OK = true;
         OK &= a.length == ArrayCount(values);
-        BigDec_Arena::ChunkList *cur = &a.data;
         for (i32 i = 0 ; i < a.length ; ++i) {
-            OK &= cur->value == values[i];
-            cur = cur->next;
+            OK &= a.chunks[i] == values[i];
         }
 
         cout << (OK ? "OK" : "ERROR") << " : " << a << "\n";
@@ -3051,6 +4321,155 @@ int Test_variable_chunkment_size(bool only_errors=false) {
     }
 
 
+    {
+        ChunkBits value = 0xF0F0'F0F0'F0F0'F0F1ull;
+        BigDec_Arena a{value};
+        u32 shift_amount = CHUNK_WIDTH * 37 + 13;
+        a.shift_left(shift_amount);
+
+        OK = true;
+        OK &= a.length == 39 && a.m_chunks_capacity >= 39;
+        for (i32 i = 0 ; i < 37 ; ++i) {
+            OK &= a.chunks[i] == 0x0;
+        }
+        OK &= a.chunks[37] == value << 13 && a.chunks[38] == value >> (CHUNK_WIDTH-13);
+
+        a.shift_right(shift_amount);
+        OK &= a.length == 1 && a.chunks[0] == value;
+
+        if (!only_errors || !OK) {
+            cout << "test #" << Tests.TestCount << " : contiguous chunks grow, shift_left and shift_right across chunk boundaries \n";
+            cout << (OK ? "OK" : "ERROR") << " : " << a << "\n";
+        }
+        Tests.Append(OK);
+    }
+
+    {
+        //(2^n - 1)^2 == 2^2n - 2^(n+1) + 1, i.e. (n-1) ones, n zeros, one 1
+        constexpr i32 n_chunks = 40;
+        ChunkBits ones[n_chunks];
+        for (i32 i = 0 ; i < n_chunks ; ++i) ones[i] = MAX_CHUNK_VAL;
+        BigDec_Arena a{ones, n_chunks};
+        BigDec_Arena b{ones, n_chunks};
+        a.mul_integer(b);
+
+        OK = true;
+        OK &= a.length == 2 * n_chunks;
+        OK &= a.chunks[0] == 0x1;
+        for (i32 i = 1 ; i < n_chunks ; ++i) {
+            OK &= a.chunks[i] == 0x0;
+        }
+        OK &= a.chunks[n_chunks] == MAX_CHUNK_VAL - 1;
+        for (i32 i = n_chunks + 1 ; i < 2 * n_chunks ; ++i) {
+            OK &= a.chunks[i] == MAX_CHUNK_VAL;
+        }
+
+        if (!only_errors || !OK) {
+            cout << "test #" << Tests.TestCount << " : mul_integer on contiguous chunks, (2^n-1)^2 \n";
+            cout << (OK ? "OK" : "ERROR") << "\n";
+        }
+        Tests.Append(OK);
+    }
+
+
+    {
+        //NOTE(##2026 10 18): lowered thresholds, so the Karatsuba, Toom and NTT paths are compared against schoolbook on small sizes
+        BigDecimal_::MulThresholds saved_thresholds = BigDecimal_::mul_thresholds;
+        BigDecimal_::MulThresholds tiers[] = { {4, 1000, 1000, 1000}, {4, 4, 1000, 1000}, {4, 4, 4, 1000}, {5, 9, 17, 33}, {1000, 1000, 1000, 4} };
+        const char *tier_names[] = { "Karatsuba", "Toom-3", "Toom-4", "mixed", "NTT" };
+        i32 sizes[][2] = { {4,4}, {7,5}, {13,13}, {31,16}, {40,39}, {64,3}, {97,50}, {120,120} };
+
+        constexpr i32 max_chunks = 120;
+        ChunkBits a_vals[max_chunks], b_vals[max_chunks], expected[2*max_chunks];
+        u64 state = 0x9E37'79B9'7F4A'7C15ull;
+        auto next_random = [&state]() { state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+
+        for (i32 tier = 0 ; tier < 5 ; ++tier) {
+            BigDecimal_::mul_thresholds = tiers[tier];
+            OK = true;
+            for (auto [a_len, b_len] : sizes) {
+                for (i32 i = 0 ; i < a_len ; ++i) a_vals[i] = tier == 3 ? MAX_CHUNK_VAL : next_random();
+                for (i32 i = 0 ; i < b_len ; ++i) b_vals[i] = tier == 3 ? MAX_CHUNK_VAL : next_random();
+                BigDecimal_::mul_chunks_basecase(expected, a_vals, a_len, b_vals, b_len);
+
+                BigDec_Arena a{a_vals, (u32)a_len};
+                BigDec_Arena b{b_vals, (u32)b_len};
+                a.mul_integer(b);
+                i32 expected_len = BigDecimal_::significant_chunks(expected, a_len + b_len);
+                OK &= a.length == expected_len && BigDecimal_::compare_chunks(a.chunks, expected, expected_len) == 0;
+            }
+            if (!only_errors || !OK) {
+                cout << "test #" << Tests.TestCount << " : mul_integer " << tier_names[tier] << " tier matches schoolbook \n";
+                cout << (OK ? "OK" : "ERROR") << "\n";
+            }
+            Tests.Append(OK);
+        }
+        BigDecimal_::mul_thresholds = saved_thresholds;
+    }
+
+
+    {
+        //NOTE(##2026 10 18): Newton/Barrett forced by a low threshold, compared against Knuth
+        BigDecimal_::DivThresholds saved_thresholds = BigDecimal_::div_thresholds;
+        i32 sizes[][2] = { {3,2}, {10,9}, {17,5}, {40,12}, {40,39}, {33,16} };
+
+        constexpr i32 max_chunks = 40;
+        ChunkBits a_vals[max_chunks], b_vals[max_chunks];
+        u64 state = 0x2545'F491'4F6C'DD1Dull;
+        auto next_random = [&state]() { state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+
+        BigDec_Arena quo_int_knuth{}, quo_frac_knuth{}, quo_int_newton{}, quo_frac_newton{};
+        OK = true;
+        for (auto [a_len, b_len] : sizes) {
+            for (i32 i = 0 ; i < a_len ; ++i) a_vals[i] = next_random();
+            for (i32 i = 0 ; i < b_len ; ++i) b_vals[i] = next_random();
+            BigDec_Arena a{a_vals, (u32)a_len, true};
+            BigDec_Arena b{b_vals, (u32)b_len};
+            u32 frac_precision = 64 * b_len + 7;
+
+            BigDecimal_::div_thresholds.newton = 1 << 30;
+            div_integer(a, b, quo_int_knuth, quo_frac_knuth, frac_precision);
+            BigDecimal_::div_thresholds.newton = 2;
+            div_integer(a, b, quo_int_newton, quo_frac_newton, frac_precision);
+
+            OK &= quo_int_knuth.equals_fractional(quo_int_newton) && quo_int_knuth.is_negative == quo_int_newton.is_negative;
+            OK &= quo_frac_knuth.equals_fractional(quo_frac_newton);
+        }
+
+        //divisors of several hundred chunks, in a scratch buffer of exactly div_newton_scratch_size chunks
+        i32 long_sizes[][2] = { {301,300}, {420,300}, {900,300}, {700,650}, {1000,500} };
+        for (auto [a_len, b_len] : long_sizes) {
+            std::vector<ChunkBits> a_newton(a_len), a_knuth(a_len), b_chunks(b_len), q_newton(a_len - b_len + 1), q_knuth(a_len - b_len + 1);
+            for (ChunkBits& chunk : a_newton) chunk = next_random();
+            for (ChunkBits& chunk : b_chunks) chunk = next_random();
+            b_chunks[b_len-1] >>= next_random() % 64;
+            if (b_chunks[b_len-1] == 0x0) b_chunks[b_len-1] = 0x1;
+            a_knuth = a_newton;
+
+            std::vector<ChunkBits> scratch(BigDecimal_::div_newton_scratch_size(a_len, b_len));
+            BigDecimal_::div_chunks_newton(q_newton.data(), a_newton.data(), a_len, b_chunks.data(), b_len,
+                                           BigDecimal_::ChunkScratch{scratch.data(), scratch.data() + scratch.size()});
+            scratch.assign(BigDecimal_::div_knuth_scratch_size(a_len, b_len), 0x0);
+            BigDecimal_::div_chunks_knuth(q_knuth.data(), a_knuth.data(), a_len, b_chunks.data(), b_len,
+                                          BigDecimal_::ChunkScratch{scratch.data(), scratch.data() + scratch.size()});
+            OK &= q_newton == q_knuth && a_newton == a_knuth;
+        }
+
+        BigDec_Arena a{a_vals, 20};
+        BigDec_Arena zero{};
+        a.normalize();
+        a.div_fractional(zero, 500);
+        OK &= a.was_divided_by_zero;
+
+        if (!only_errors || !OK) {
+            cout << "test #" << Tests.TestCount << " : div_integer Newton/Barrett matches Knuth \n";
+            cout << (OK ? "OK" : "ERROR") << "\n";
+        }
+        Tests.Append(OK);
+        BigDecimal_::div_thresholds = saved_thresholds;
+    }
+
+
     BigDec_Arena::close_context(true);
 
     cout << "|-> " << Tests << "\n\n";
@@ -2,6 +2,7 @@
 #define MEMORY_MANAGEMENT_SERVICE_H
 
 #include <iostream> //for debug prints only
+#include <bit> //bit_width
 
 #include "G_Essentials.h"
 #include "G_Miscellany_Utility.h"
@@ -126,10 +127,34 @@ array<T> MakeArray(memory_arena& Arena, std::initializer_list<T> Args) {
 #define FUN_DELETER(name) void name (u8 *memory, size_t size)
 typedef FUN_DELETER((*FunPtrDeleter));
 
+//NOTE(##2026 10 18): size classes of PoolAlloc, class k holds blocks of POOL_MIN_BLOCK_SIZE << k bytes
+constexpr memory_index POOL_MIN_BLOCK_SIZE = 16;
+constexpr i32 POOL_SIZE_CLASS_COUNT = 32;
+
+/** \return the size class for a block of Size bytes, POOL_SIZE_CLASS_COUNT if it is too big for any */
+inline i32 PoolSizeClass(memory_index Size) {
+    if (Size <= POOL_MIN_BLOCK_SIZE) return 0;
+    //NOTE(##2026 10 18): the smallest Class with POOL_MIN_BLOCK_SIZE << Class >= Size, i.e. ceil(log2(Size / POOL_MIN_BLOCK_SIZE))
+    i32 Class = static_cast<i32>(std::bit_width((Size - 1) / POOL_MIN_BLOCK_SIZE));
+    return Class < POOL_SIZE_CLASS_COUNT ? Class : POOL_SIZE_CLASS_COUNT;
+}
+
+/** \brief a position in an ArenaAllocMeta to go back to, see ArenaAllocMeta::checkpoint() */
+struct ArenaCheckpoint {
+    memory_arena *overflow;
+    memory_index used;
+    memory_arena *pinned; //NOTE(##2026 10 18): ArenaAllocMeta::pinned of the enclosing checkpoint
+};
+
 struct ArenaAllocMeta {
     memory_arena arena;
     FunPtrDeleter deleter;
     i32 ref_count = 0;
+    void *free_lists[POOL_SIZE_CLASS_COUNT] = {}; //NOTE(##2026 10 18): recycled blocks of PoolAlloc, linked through their first bytes
+    memory_arena *overflow = nullptr;   //NOTE(##2026 10 18): newest overflow block once the arena is full, older ones through Parent
+    memory_index overflow_closed = 0;   //NOTE(##2026 10 18): bytes used in the overflow blocks below the newest
+    memory_index high_water = 0;        //NOTE(##2026 10 18): most bytes_used() ever, reset() keeps it
+    memory_arena *pinned = nullptr;     //NOTE(##2026 10 18): overflow block of the innermost live checkpoint, free_last() keeps it and all below
 //    ArenaAllocMeta *parent = nullptr; //TODO(ArokhSlade##2024 09 19)
 //    ArenaAllocMeta *first_child = nullptr;
 //    ArenaAllocMeta *next_sibling = nullptr;
@@ -140,6 +165,7 @@ struct ArenaAllocMeta {
     }
 
     void erase() {
+        while (overflow) pop_overflow_block();
         deleter(reinterpret_cast<u8 *>(this), arena.Size);
     }
 
@@ -148,16 +174,155 @@ struct ArenaAllocMeta {
         InitializeArena(&arena, size, (u8*)this); //NOTE(ArokhSlade##2024 09 20): placement-new
         arena.Used = sizeof(ArenaAllocMeta); //NOTE(ArokhSlade##2024 09 20): *this always lives as arena's first data
         deleter = deleter_;
+        high_water = arena.Used;
     }
 
     ArenaAllocMeta(const ArenaAllocMeta& other) = delete;
     ArenaAllocMeta& operator=(const ArenaAllocMeta& other) =delete;
 
 
+    /** \return bytes in use, the meta data included, in the arena and all overflow blocks */
+    memory_index bytes_used() {
+        return arena.Used + overflow_closed + (overflow ? overflow->Used : 0);
+    }
+
+    /**
+     *  \brief  bump allocation from the arena. when it is full, from overflow blocks of at least the arena's size,
+     *          taken from the heap and chained, so the arena never runs out.
+     */
     void* allocate(size_t size) {
-        void * result = PushSize_(&arena, size);
+        void * result = nullptr;
+        if (overflow == nullptr && arena.Used + size <= arena.Size) {
+            result = PushSize_(&arena, size);
+        } else {
+            if (overflow == nullptr || overflow->Used + size > overflow->Size) push_overflow_block(size);
+            result = PushSize_(overflow, size);
+        }
+        if (bytes_used() > high_water) high_water = bytes_used();
         return result;
     }
+
+    /**
+     *  \brief  gives back the most recent allocation, anything else stays where it is until reset() or a checkpoint.
+     *  \return whether the block was the most recent one
+     */
+    bool free_last(void *block, size_t size) {
+        memory_arena *Top = overflow ? overflow : &arena;
+        if (block == nullptr || static_cast<u8 *>(block) + size != Top->Base + Top->Used) return false;
+        PopSize_(Top, size);
+        //NOTE(##2026 10 18): a block that a live checkpoint refers to stays, even empty. restore() goes back into it.
+        if (overflow && overflow->Used == 0 && overflow != pinned) pop_overflow_block();
+        return true;
+    }
+
+    /** \note   checkpoints must be restored in LIFO order, a checkpoint that is never restored keeps its overflow block until reset() */
+    ArenaCheckpoint checkpoint() {
+        ArenaCheckpoint Result {overflow, overflow ? overflow->Used : arena.Used, pinned};
+        pinned = overflow;
+        return Result;
+    }
+
+    /**
+     *  \brief  frees everything allocated after Checkpoint was taken, overflow blocks included.
+     *  \note   blocks freed below the checkpoint in the meantime count as used again until the enclosing checkpoint or reset().
+     *  \note   the free lists of a PoolAlloc lose the blocks above the checkpoint, the ones below stay.
+     */
+    void restore(ArenaCheckpoint Checkpoint) {
+        drop_pooled_above(Checkpoint);
+        while (overflow != Checkpoint.overflow) {
+            HardAssert(overflow); //NOTE(##2026 10 18): checkpoints must be restored in LIFO order
+            pop_overflow_block();
+        }
+        (overflow ? overflow : &arena)->Used = Checkpoint.used;
+        pinned = Checkpoint.pinned;
+    }
+
+    /**
+     *  \brief  takes a block of the size class of Size from its free list, or a new one from the arena.
+     *  \note   sizes beyond the largest class come straight from the arena and are never recycled.
+     */
+    void* allocate_pooled(size_t size) {
+        i32 Class = PoolSizeClass(size);
+        if (Class == POOL_SIZE_CLASS_COUNT) return allocate(size);
+        void *Block = free_lists[Class];
+        if (Block) {
+            free_lists[Class] = *reinterpret_cast<void **>(Block);
+            return Block;
+        }
+        return allocate(POOL_MIN_BLOCK_SIZE << Class);
+    }
+
+    /** \brief puts the block back on the free list of its size class, Size must be the one it was allocated with. */
+    void deallocate_pooled(void *block, size_t size) {
+        i32 Class = PoolSizeClass(size);
+        if (block == nullptr || Class == POOL_SIZE_CLASS_COUNT) return;
+        *reinterpret_cast<void **>(block) = free_lists[Class];
+        free_lists[Class] = block;
+    }
+
+    /** \brief gives back everything but the meta data, which is the arena's first block. */
+    void reset() {
+        while (overflow) pop_overflow_block();
+        ResetArena(&arena);
+        arena.Used = sizeof(ArenaAllocMeta);
+        for (void *&List : free_lists) List = nullptr;
+        pinned = nullptr;
+    }
+
+    private:
+
+    /** \return whether Block was allocated after Checkpoint was taken */
+    bool is_above(void *Block, ArenaCheckpoint const& Checkpoint) {
+        u8 *Address = static_cast<u8 *>(Block);
+        for (memory_arena *Cur = overflow ; Cur != Checkpoint.overflow ; Cur = Cur->Parent) {
+            if (Address >= Cur->Base && Address < Cur->Base + Cur->Size) return true;
+        }
+        memory_arena *Bottom = Checkpoint.overflow ? Checkpoint.overflow : &arena;
+        return Address >= Bottom->Base + Checkpoint.used && Address < Bottom->Base + Bottom->Size;
+    }
+
+    void drop_pooled_above(ArenaCheckpoint const& Checkpoint) {
+        for (void *&List : free_lists) {
+            void **Link = &List;
+            while (*Link) {
+                void **Next = reinterpret_cast<void **>(*Link);
+                if (is_above(*Link, Checkpoint)) *Link = *Next;
+                else Link = Next;
+            }
+        }
+    }
+
+    //NOTE(##2026 10 18): an overflow block is a memory_arena followed by its storage, in one heap allocation
+    void push_overflow_block(size_t size) {
+        memory_index Size = size > arena.Size ? size : arena.Size;
+        u8 *Storage = new u8[sizeof(memory_arena) + Size];
+        memory_arena *Block = reinterpret_cast<memory_arena *>(Storage);
+        InitializeArena(Block, Size, Storage + sizeof(memory_arena));
+        Block->Parent = overflow;
+        if (overflow) overflow_closed += overflow->Used;
+        overflow = Block;
+    }
+
+    void pop_overflow_block() {
+        memory_arena *Block = overflow;
+        overflow = Block->Parent;
+        if (overflow) overflow_closed -= overflow->Used;
+        delete[] reinterpret_cast<u8 *>(Block);
+    }
+};
+
+/**
+ *  \brief  restores the arena to where it was when the scope began, see ArenaAllocMeta::restore().
+ */
+struct ArenaScope {
+    ArenaAllocMeta *meta;
+    ArenaCheckpoint saved;
+
+    explicit ArenaScope(ArenaAllocMeta *meta_) : meta{meta_}, saved{meta_->checkpoint()} {}
+    ~ArenaScope() { meta->restore(saved); }
+
+    ArenaScope(const ArenaScope& other) = delete;
+    ArenaScope& operator=(const ArenaScope& other) = delete;
 };
 
 /**
@@ -253,9 +418,36 @@ struct ArenaAlloc{
         return result;
     }
 
+    //NOTE(##2026 10 18): only the most recent allocation is given back (LIFO), the rest waits for reset() or a checkpoint
+    void deallocate(T* p, size_t n) {
+        meta->free_last(p, n * sizeof(T));
+    }
+};
+
+
+/**
+ *  \brief      ArenaAlloc whose deallocate recycles: blocks are rounded up to power-of-two size classes and freed blocks
+ *              go on a free list per class in the shared meta data, allocate takes from there before the arena grows.
+ *  \note       memory goes back to the arena as a whole only, by ArenaAllocMeta::reset() or when the last allocator dies.
+ **/
+template<typename T>
+struct PoolAlloc : ArenaAlloc<T> {
+    using value_type = T;
+    using ArenaAlloc<T>::ArenaAlloc;
+
+    PoolAlloc() = default;
+    PoolAlloc(const PoolAlloc& other) = default;
+    PoolAlloc& operator=(const PoolAlloc& other) = default;
+
+    template <typename U>
+    explicit PoolAlloc(PoolAlloc<U> const& other) : ArenaAlloc<T>(other) {}
+
+    T* allocate(size_t n) {
+        return reinterpret_cast<T*>(this->meta->allocate_pooled(n * sizeof(T)));
+    }
+
     void deallocate(T* p, size_t n) {
-        /*arena doesn't deallocate*/
-        return;
+        this->meta->deallocate_pooled(p, n * sizeof(T));
     }
 };
 